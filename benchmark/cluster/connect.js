@@ -0,0 +1,65 @@
+// Test the rate at which a cluster accepts connections with each of the
+// scheduling policies.
+'use strict';
+
+const cluster = require('cluster');
+const net = require('net');
+
+if (cluster.isMaster) {
+  const common = require('../common.js');
+  const PORT = common.PORT;
+  const bench = common.createBenchmark(main, {
+    policy: ['rr', 'none', 'reuseport'],
+    workers: [2, 4],
+    concurrency: [100],
+    dur: [5]
+  }, {
+    test: { workers: 1, concurrency: 10 }
+  });
+
+  function main({ policy, workers, concurrency, dur }) {
+    cluster.schedulingPolicy = {
+      rr: cluster.SCHED_RR,
+      none: cluster.SCHED_NONE,
+      reuseport: cluster.SCHED_REUSEPORT
+    }[policy];
+
+    let listening = 0;
+    let connections = 0;
+    let running = true;
+
+    for (let i = 0; i < workers; i++) {
+      cluster.fork({ PORT }).on('listening', () => {
+        if (++listening !== workers)
+          return;
+
+        for (let i = 0; i < concurrency; i++)
+          connect();
+
+        bench.start();
+        setTimeout(() => {
+          running = false;
+          bench.end(connections);
+          for (const id in cluster.workers)
+            cluster.workers[id].kill();
+          process.exit(0);
+        }, dur * 1000);
+      });
+    }
+
+    function connect() {
+      const socket = net.connect(PORT);
+      socket.on('error', () => {});
+      socket.on('end', () => connections++);
+      socket.on('close', () => {
+        if (running)
+          connect();
+      });
+      socket.resume();
+    }
+  }
+} else {
+  net.createServer((socket) => {
+    socket.end('ok');
+  }).listen(+process.env.PORT);
+}
@@ -0,0 +1,92 @@
+// Test the number of datagrams per second that can be sent and received with
+// one datagram per system call versus recvmmsg()/sendmmsg() batching, and
+// versus segmentation and coalescing in the kernel (UDP_SEGMENT/UDP_GRO).
+'use strict';
+
+const common = require('../common.js');
+const dgram = require('dgram');
+const PORT = common.PORT;
+
+// `num` is the number of datagrams to send each time.
+const bench = common.createBenchmark(main, {
+  len: [64, 512],
+  num: [100],
+  batch: ['none', 'send', 'recv', 'both', 'gso'],
+  dur: [5]
+});
+
+function main({ dur, len, num, batch }) {
+  const sendBatch = batch === 'send' || batch === 'both';
+  const recvBatch = batch === 'recv' || batch === 'both' || batch === 'gso';
+  const gso = batch === 'gso';
+  const list = [];
+  for (let i = 0; i < num; i++)
+    list.push(Buffer.allocUnsafe(len));
+
+  let received = 0;
+  const receiver = dgram.createSocket({
+    type: 'udp4',
+    recvBatch,
+    recvGRO: gso
+  });
+  if (recvBatch) {
+    receiver.on('messagebatch', (data, offsets, addresses) => {
+      received += addresses.length;
+    });
+  } else {
+    receiver.on('message', () => {
+      received++;
+    });
+  }
+
+  const sender = dgram.createSocket('udp4');
+
+  function send() {
+    // The setImmediate() lets the receiver run between bursts.
+    setImmediate(() => {
+      if (gso) {
+        // One message per 64 KiB worth of datagrams.
+        let pending = 0;
+        const perMessage = Math.min(64, Math.floor(65507 / len));
+        for (let i = 0; i < num; i += perMessage) {
+          pending++;
+          const n = Math.min(perMessage, num - i);
+          sender.send(Buffer.concat(list.slice(i, i + n)), PORT, '127.0.0.1',
+                      () => {
+                        if (--pending === 0)
+                          send();
+                      });
+        }
+      } else if (sendBatch) {
+        sender.sendBatch(list, PORT, '127.0.0.1', send);
+      } else {
+        let pending = num;
+        for (let i = 0; i < num; i++) {
+          sender.send(list[i], PORT, '127.0.0.1', () => {
+            if (--pending === 0)
+              send();
+          });
+        }
+      }
+    });
+  }
+
+  function start() {
+    bench.start();
+    send();
+
+    setTimeout(() => {
+      bench.end(received);
+      process.exit(0);
+    }, dur * 1000);
+  }
+
+  receiver.bind(PORT, () => {
+    if (!gso)
+      return start();
+    sender.bind(0, () => {
+      sender.setSendSegmentSize(len);
+      start();
+    });
+  });
+}
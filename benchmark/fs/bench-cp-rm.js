@@ -0,0 +1,56 @@
+// Test the speed of copying and removing a directory tree recursively.
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  dirs: [10, 100],
+  files: [10, 100],
+  op: ['cp', 'rm'],
+  mode: ['async', 'sync']
+});
+
+function makeTree(root, dirs, files) {
+  fs.mkdirSync(root);
+  for (let i = 0; i < dirs; i++) {
+    // Nest some of the directories to get a deeper tree.
+    const dir = path.join(root, `${i % 10}`, `d-${i}`);
+    fs.mkdirSync(dir, { recursive: true });
+    for (let j = 0; j < files; j++)
+      fs.writeFileSync(path.join(dir, `f-${j}`), 'x'.repeat(j));
+  }
+}
+
+async function main({ n, dirs, files, op, mode }) {
+  tmpdir.refresh();
+  const src = path.join(tmpdir.path, 'src');
+  makeTree(src, dirs, files);
+  const dest = (i) => path.join(tmpdir.path, `dest-${i}`);
+
+  // For `rm`, create the trees to remove first.
+  if (op === 'rm') {
+    for (let i = 0; i < n; i++)
+      fs.cpSync(src, dest(i), { recursive: true });
+  }
+
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    if (op === 'cp') {
+      if (mode === 'async')
+        await fs.promises.cp(src, dest(i), { recursive: true });
+      else
+        fs.cpSync(src, dest(i), { recursive: true });
+    } else if (mode === 'async') {
+      await fs.promises.rm(dest(i), { recursive: true });
+    } else {
+      fs.rmSync(dest(i), { recursive: true });
+    }
+  }
+  bench.end(n);
+
+  tmpdir.refresh();
+}
@@ -0,0 +1,39 @@
+// Test the speed of reading scattered values from a file that is mapped into
+// memory, compared to reading the whole file first.
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  n: [100],
+  size: [1024 * 1024, 64 * 1024 * 1024],
+  lookups: [100],
+  method: ['mmap', 'readFile']
+});
+
+async function main({ n, size, lookups, method }) {
+  tmpdir.refresh();
+  const filename = path.resolve(tmpdir.path,
+                                `.removeme-benchmark-garbage-${process.pid}`);
+  fs.writeFileSync(filename, Buffer.alloc(size, 'x'));
+
+  let sum = 0;
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    const filehandle = await fs.promises.open(filename);
+    const data = method === 'mmap' ?
+      new Uint8Array(await filehandle.mmap({ advice: 'random' })) :
+      await filehandle.readFile();
+    for (let j = 0; j < lookups; j++)
+      sum += data[(j * 7919) % size];
+    await filehandle.close();
+  }
+  bench.end(n);
+
+  if (sum !== n * lookups * 0x78)
+    throw new Error('unexpected data');
+  tmpdir.refresh();
+}
@@ -0,0 +1,60 @@
+// Test the rate of random 4 KiB page reads (IOPS) from a file, with one
+// filehandle.read() per page or with batches of pages per
+// filehandle.readMany().
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../../test/common/tmpdir');
+
+const kPageSize = 4096;
+
+const bench = common.createBenchmark(main, {
+  n: [100000],
+  pages: [16384],
+  batch: [1, 64, 1024],
+  method: ['read', 'readMany']
+});
+
+async function main({ n, pages, batch, method }) {
+  tmpdir.refresh();
+  const filename = path.resolve(tmpdir.path,
+                                `.removeme-benchmark-garbage-${process.pid}`);
+  fs.writeFileSync(filename, Buffer.alloc(pages * kPageSize, 'x'));
+  const filehandle = await fs.promises.open(filename);
+
+  const requests = [];
+  for (let i = 0; i < batch; i++)
+    requests.push({ buffer: Buffer.alloc(kPageSize), position: 0 });
+
+  // A fixed pseudo-random sequence of pages.
+  let seed = 1;
+  function nextPosition() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return (seed % pages) * kPageSize;
+  }
+
+  let bytes = 0;
+  bench.start();
+  for (let done = 0; done < n; done += batch) {
+    for (let i = 0; i < batch; i++)
+      requests[i].position = nextPosition();
+    if (method === 'readMany') {
+      const { bytesRead } = await filehandle.readMany(requests);
+      for (let i = 0; i < batch; i++)
+        bytes += bytesRead[i];
+    } else {
+      const results = await Promise.all(requests.map(({ buffer, position }) =>
+        filehandle.read(buffer, 0, kPageSize, position)));
+      for (let i = 0; i < batch; i++)
+        bytes += results[i].bytesRead;
+    }
+  }
+  bench.end(n);
+
+  await filehandle.close();
+  if (bytes !== Math.ceil(n / batch) * batch * kPageSize)
+    throw new Error('unexpected number of bytes read');
+  tmpdir.refresh();
+}
@@ -0,0 +1,48 @@
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+
+const bench = common.createBenchmark(main, {
+  n: [20e4],
+  paths: [10, 1000, 10000],
+  method: ['statMany', 'stat'],
+  statType: ['lstat', 'stat']
+});
+
+function main({ n, paths: count, method, statType }) {
+  // A mix of paths that exist and paths that do not.
+  const dir = path.resolve(__dirname, '..');
+  const entries = fs.readdirSync(dir);
+  const paths = [];
+  for (let i = 0; i < count; i++) {
+    const name = i % 2 ? entries[i % entries.length] : `missing-${i}`;
+    paths.push(path.join(dir, name));
+  }
+
+  const statMany = fs[`${statType}Many`];
+  const stat = fs[statType];
+
+  function statEach(paths, callback) {
+    let pending = paths.length;
+    const results = new Array(paths.length);
+    for (let i = 0; i < paths.length; i++) {
+      stat(paths[i], (err, stats) => {
+        results[i] = err || stats;
+        if (--pending === 0)
+          callback(null, results);
+      });
+    }
+  }
+
+  const fn = method === 'statMany' ? statMany : statEach;
+  let remaining = n;
+  bench.start();
+  (function r() {
+    if (remaining <= 0)
+      return bench.end(n);
+    remaining -= count;
+    fn(paths, r);
+  }());
+}
@@ -0,0 +1,48 @@
+// Test the speed of walking a directory tree with fs.walk() compared to
+// recursively calling fs.promises.readdir().
+'use strict';
+
+const common = require('../common');
+const fs = require('fs');
+const path = require('path');
+
+const bench = common.createBenchmark(main, {
+  n: [10],
+  dir: [ 'lib', 'test' ],
+  mode: [ 'walk', 'readdir' ],
+  withStats: [ 'true', 'false' ]
+});
+
+async function readdirRecursive(dir, withStats) {
+  let counter = 0;
+  const dirents = await fs.promises.readdir(dir, { withFileTypes: true });
+  await Promise.all(dirents.map(async (dirent) => {
+    counter++;
+    const fullPath = path.join(dir, dirent.name);
+    if (withStats)
+      await fs.promises.lstat(fullPath);
+    if (dirent.isDirectory())
+      counter += await readdirRecursive(fullPath, withStats);
+  }));
+  return counter;
+}
+
+async function main({ n, dir, mode, withStats }) {
+  const fullPath = path.resolve(__dirname, '../../', dir);
+  withStats = withStats === 'true';
+
+  bench.start();
+
+  let counter = 0;
+  for (let i = 0; i < n; i++) {
+    if (mode === 'walk') {
+      // eslint-disable-next-line no-unused-vars
+      for await (const entry of fs.walk(fullPath, { withStats }))
+        counter++;
+    } else {
+      counter += await readdirRecursive(fullPath, withStats);
+    }
+  }
+
+  bench.end(counter);
+}
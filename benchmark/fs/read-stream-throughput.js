@@ -5,6 +5,7 @@ const path = require('path');
 const common = require('../common.js');
 const fs = require('fs');
 const assert = require('assert');
+const { StringDecoder } = require('string_decoder');
 
 const tmpdir = require('../../test/common/tmpdir');
 tmpdir.refresh();
@@ -15,11 +16,15 @@ const bench = common.createBenchmark(main, {
   encodingType: ['buf', 'asc', 'utf'],
   filesize: [1000 * 1024],
   highWaterMark: [1024, 4096, 65535, 1024 * 1024],
+  // `chunks` reads through filehandle.readChunks() into a fixed set of
+  // buffers, with `readAhead` reads in flight.
+  api: ['stream', 'chunks'],
+  readAhead: [4],
   n: 1024
 });
 
 function main(conf) {
-  const { encodingType, highWaterMark, filesize } = conf;
+  const { encodingType, highWaterMark, filesize, api, readAhead } = conf;
   let { n } = conf;
 
   let encoding = '';
@@ -52,7 +57,12 @@ function main(conf) {
 
   try { fs.unlinkSync(filename); } catch {}
   const ws = fs.createWriteStream(filename);
-  ws.on('close', runTest.bind(null, filesize, highWaterMark, encoding, n));
+  if (api === 'chunks') {
+    ws.on('close', runChunksTest.bind(null, filesize, highWaterMark, encoding,
+                                      n, readAhead));
+  } else {
+    ws.on('close', runTest.bind(null, filesize, highWaterMark, encoding, n));
+  }
   ws.on('drain', write);
   write();
   function write() {
@@ -86,3 +96,23 @@ function runTest(filesize, highWaterMark, encoding, n) {
     bench.end(bytes / (1024 * 1024));
   });
 }
+
+async function runChunksTest(filesize, highWaterMark, encoding, n, readAhead) {
+  assert(fs.statSync(filename).size === filesize * n);
+  const filehandle = await fs.promises.open(filename);
+  // One buffer more than reads in flight, for the chunk that is being used.
+  const buffers = [];
+  for (let i = 0; i <= readAhead; i++)
+    buffers.push(Buffer.allocUnsafeSlow(highWaterMark));
+  const decoder = encoding ? new StringDecoder(encoding) : null;
+
+  bench.start();
+  let bytes = 0;
+  for await (const chunk of filehandle.readChunks({ buffers, readAhead })) {
+    bytes += decoder ? decoder.write(chunk).length : chunk.length;
+  }
+  await filehandle.close();
+  try { fs.unlinkSync(filename); } catch {}
+  // MB/sec
+  bench.end(bytes / (1024 * 1024));
+}
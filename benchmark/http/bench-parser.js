@@ -1,21 +1,38 @@
 'use strict';
 
 const common = require('../common');
+const v8 = require('v8');
 
 const bench = common.createBenchmark(main, {
   len: [4, 8, 16, 32],
+  frag: [0, 16, 1],
+  // 'common' sends header names and values that browsers and proxies use,
+  // 'random' sends header values that are different for every request.
+  headers: ['random', 'common'],
+  // 'heap' reports the bytes allocated on the young generation per request
+  // instead of the number of requests per second.
+  measure: ['time', 'heap'],
+  // Whether the parser reports each request with a single callback instead
+  // of one for the headers and one for the end of the message.
+  onmessage: [0, 1],
   n: [1e5]
 }, {
-  flags: ['--expose-internals', '--no-warnings']
+  flags: ['--expose-internals', '--expose-gc', '--no-warnings']
 });
 
-function main({ len, n }) {
+function youngGenerationUsed() {
+  return v8.getHeapSpaceStatistics()
+    .find(({ space_name }) => space_name === 'new_space').space_used_size;
+}
+
+function main({ len, frag, headers, measure, onmessage, n }) {
   const { HTTPParser } = common.binding('http_parser');
   const REQUEST = HTTPParser.REQUEST;
   const kOnHeaders = HTTPParser.kOnHeaders | 0;
   const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
   const kOnBody = HTTPParser.kOnBody | 0;
   const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+  const kOnMessage = HTTPParser.kOnMessage | 0;
   const CRLF = '\r\n';
 
   function processHeader(header, n) {
@@ -29,6 +46,43 @@ function main({ len, n }) {
     bench.end(n);
   }
 
+  // Parse in batches that are small enough to not trigger a scavenge, and
+  // add up how much the young generation grew during each of them.
+  function measureHeap(header, n) {
+    const parser = newParser(REQUEST);
+    const batch = 100;
+    let allocated = 0;
+
+    const start = process.hrtime();
+    for (let i = 0; i < n; i += batch) {
+      global.gc();
+      const before = youngGenerationUsed();
+      for (let j = 0; j < batch; j++) {
+        parser.execute(header, 0, header.length);
+        parser.initialize(REQUEST, {});
+      }
+      allocated += youngGenerationUsed() - before;
+    }
+    bench.report(allocated / n, process.hrtime(start));
+  }
+
+  // Feed the header in chunks of `frag` bytes, like a peer or proxy that
+  // splits the header across many TCP segments.
+  function processFragmentedHeader(header, frag, n) {
+    const parser = newParser(REQUEST);
+    const chunks = [];
+    for (let i = 0; i < header.length; i += frag)
+      chunks.push(header.slice(i, i + frag));
+
+    bench.start();
+    for (let i = 0; i < n; i++) {
+      for (let j = 0; j < chunks.length; j++)
+        parser.execute(chunks[j], 0, chunks[j].length);
+      parser.initialize(REQUEST, {});
+    }
+    bench.end(n);
+  }
+
   function newParser(type) {
     const parser = new HTTPParser();
     parser.initialize(type, {});
@@ -39,16 +93,38 @@ function main({ len, n }) {
     parser[kOnHeadersComplete] = function() { };
     parser[kOnBody] = function() { };
     parser[kOnMessageComplete] = function() { };
+    if (onmessage)
+      parser[kOnMessage] = function() { };
 
     return parser;
   }
 
   let header = `GET /hello HTTP/1.1${CRLF}Content-Type: text/plain${CRLF}`;
 
-  for (let i = 0; i < len; i++) {
-    header += `X-Filler${i}: ${Math.random().toString(36).substr(2)}${CRLF}`;
+  if (headers === 'common') {
+    const lines = [
+      'Host: localhost',
+      'Connection: keep-alive',
+      'Accept: */*',
+      'Accept-Encoding: gzip, deflate, br',
+      'Cache-Control: no-cache',
+      'Pragma: no-cache',
+      'Upgrade: websocket',
+      'X-Forwarded-Proto: https',
+    ];
+    for (let i = 0; i < len; i++)
+      header += `${lines[i % lines.length]}${CRLF}`;
+  } else {
+    for (let i = 0; i < len; i++) {
+      header += `X-Filler${i}: ${Math.random().toString(36).substr(2)}${CRLF}`;
+    }
   }
   header += CRLF;
 
-  processHeader(Buffer.from(header), n);
+  if (measure === 'heap')
+    measureHeap(Buffer.from(header), n);
+  else if (frag > 0)
+    processFragmentedHeader(Buffer.from(header), frag, n);
+  else
+    processHeader(Buffer.from(header), n);
 }
@@ -4,18 +4,19 @@ const http = require('http');
 
 const bench = common.createBenchmark(main, {
   connections: [50], // Concurrent connections
-  headers: [20], // Number of header lines to append after the common headers
+  headers: [20, 60], // Number of header lines to add after the common ones
   w: [0, 6], // Amount of trailing whitespace
+  lazy: [0, 1], // Whether the server uses the `lazyHeaders` option
   duration: 5
 });
 
-function main({ connections, headers, w, duration }) {
-  const server = http.createServer((req, res) => {
+function main({ connections, headers, w, lazy, duration }) {
+  const server = http.createServer({ lazyHeaders: lazy === 1 }, (req, res) => {
     res.end();
   });
 
   server.listen(common.PORT, () => {
-    const headers = {
+    const reqHeaders = {
       'Content-Type': 'text/plain',
       'Accept': 'text/plain',
       'User-Agent': 'nodejs-benchmark',
@@ -28,12 +29,12 @@ function main({ connections, headers, w, duration }) {
       // - wrk can only send trailing OWS. This is a side-effect of wrk
       // processing requests with http-parser before sending them, causing
       // leading OWS to be stripped.
-      headers[`foo${i}`] = `some header value ${i}${' \t'.repeat(w / 2)}`;
+      reqHeaders[`foo${i}`] = `some header value ${i}${' \t'.repeat(w / 2)}`;
     }
     bench.http({
       path: '/',
       connections,
-      headers,
+      headers: reqHeaders,
       duration
     }, () => {
       server.close();
@@ -0,0 +1,51 @@
+// Test the throughput of an http server that serves a static file, either by
+// piping a fs.ReadStream into the response or with response.sendFile().
+'use strict';
+
+const common = require('../common.js');
+const fs = require('fs');
+const path = require('path');
+const tmpdir = require('../../test/common/tmpdir');
+
+const bench = common.createBenchmark(main, {
+  len: [4 * 1024, 64 * 1024, 1024 * 1024],
+  method: ['pipe', 'sendFile'],
+  c: [50],
+  duration: 5
+});
+
+function main({ len, method, c, duration }) {
+  const http = require('http');
+
+  tmpdir.refresh();
+  const filename = path.join(tmpdir.path, `static-file-${process.pid}`);
+  fs.writeFileSync(filename, Buffer.alloc(len, 'x'));
+  const headers = {
+    'Content-Type': 'application/octet-stream',
+    'Content-Length': len
+  };
+
+  const server = http.createServer((req, res) => {
+    res.writeHead(200, headers);
+    if (method === 'pipe') {
+      fs.createReadStream(filename).pipe(res);
+      return;
+    }
+    fs.open(filename, 'r', (err, fd) => {
+      if (err)
+        throw err;
+      res.sendFile(fd, () => fs.close(fd, () => {}));
+      res.end();
+    });
+  });
+
+  server.listen(common.PORT, () => {
+    bench.http({
+      connections: c,
+      duration
+    }, () => {
+      server.close();
+      tmpdir.refresh();
+    });
+  });
+}
@@ -0,0 +1,62 @@
+// Test the time it takes for several Workers to load the same application,
+// with and without --experimental-module-stat-cache.
+'use strict';
+const fs = require('fs');
+const path = require('path');
+const { spawnSync } = require('child_process');
+const common = require('../common.js');
+
+const tmpdir = require('../../test/common/tmpdir');
+const appDirectory = path.join(tmpdir.path, 'nodejs-benchmark-module-app');
+
+const bench = common.createBenchmark(main, {
+  cache: ['off', 'on', 'mtime'],
+  workers: [8],
+  packages: [500],
+  n: [5]
+}, {
+  test: { workers: 2, packages: 10, n: 1 }
+});
+
+// Creates `packages` packages in node_modules, each with a package.json and
+// a few nested files, and an entry point that requires all of them.
+function createApp(packages) {
+  const modules = path.join(appDirectory, 'node_modules');
+  let entry = '';
+  for (let i = 0; i < packages; i++) {
+    const dir = path.join(modules, `pkg${i}`);
+    fs.mkdirSync(path.join(dir, 'lib'), { recursive: true });
+    fs.writeFileSync(path.join(dir, 'package.json'),
+                     JSON.stringify({ name: `pkg${i}`, main: 'lib/index' }));
+    fs.writeFileSync(path.join(dir, 'lib', 'index.js'),
+                     'module.exports = require("./util");');
+    fs.writeFileSync(path.join(dir, 'lib', 'util.js'),
+                     'module.exports = {};');
+    entry += `require('pkg${i}');\n`;
+  }
+  fs.writeFileSync(path.join(appDirectory, 'index.js'), entry);
+}
+
+function main({ cache, workers, packages, n }) {
+  tmpdir.refresh();
+  createApp(packages);
+
+  const script = `
+    const { Worker } = require('worker_threads');
+    for (let i = 0; i < ${workers}; i++)
+      new Worker(${JSON.stringify(path.join(appDirectory, 'index.js'))});
+  `;
+  const args = ['-e', script];
+  if (cache !== 'off')
+    args.unshift(`--experimental-module-stat-cache=${cache}`);
+
+  bench.start();
+  for (let i = 0; i < n; i++) {
+    const child = spawnSync(process.execPath, args, { stdio: 'inherit' });
+    if (child.status !== 0)
+      throw new Error(`Child process exited with code ${child.status}`);
+  }
+  bench.end(n);
+
+  tmpdir.refresh();
+}
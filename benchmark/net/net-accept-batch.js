@@ -0,0 +1,51 @@
+// Test the rate at which a server accepts connections when many clients
+// connect at the same time, with and without batched accepts.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  concurrency: [10, 100],
+  acceptBatchSize: [0, 16, 128],
+  dur: [5]
+}, {
+  test: { concurrency: 10 }
+});
+
+function main({ dur, concurrency, acceptBatchSize }) {
+  let accepted = 0;
+  let running = true;
+
+  const server = net.createServer((socket) => {
+    accepted++;
+    socket.destroy();
+  });
+
+  const listenOptions = { port: PORT };
+  if (acceptBatchSize > 0)
+    listenOptions.acceptBatchSize = acceptBatchSize;
+
+  server.listen(listenOptions, () => {
+    for (let i = 0; i < concurrency; i++)
+      connect();
+
+    bench.start();
+    setTimeout(() => {
+      running = false;
+      bench.end(accepted);
+      process.exit(0);
+    }, dur * 1000);
+  });
+
+  function connect() {
+    const socket = net.connect(PORT);
+    socket.on('error', () => {});
+    socket.on('close', () => {
+      if (running)
+        connect();
+    });
+    socket.resume();
+  }
+}
@@ -0,0 +1,53 @@
+// Test the rate of small writes when a protocol sends many small messages
+// per event loop iteration, with and without write coalescing.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  len: [16, 128],
+  messages: [1, 16, 64],
+  coalesceWrites: [0, 1],
+  dur: [5]
+}, {
+  test: { messages: 16 }
+});
+
+function main({ dur, len, messages, coalesceWrites }) {
+  const message = Buffer.alloc(len, 'x');
+  let received = 0;
+
+  const server = net.createServer((socket) => {
+    socket.on('data', (data) => {
+      received += data.length;
+    });
+  });
+
+  server.listen(PORT, () => {
+    const socket = net.connect({
+      port: PORT,
+      coalesceWrites: !!coalesceWrites
+    });
+
+    function write() {
+      let ret = true;
+      for (let i = 0; i < messages; i++)
+        ret = socket.write(message);
+      if (ret)
+        setImmediate(write);
+      else
+        socket.once('drain', write);
+    }
+
+    socket.on('connect', () => {
+      write();
+      bench.start();
+      setTimeout(() => {
+        bench.end(received / len);
+        process.exit(0);
+      }, dur * 1000);
+    });
+  });
+}
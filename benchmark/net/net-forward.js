@@ -0,0 +1,53 @@
+// Test the throughput of a proxy that relays data from one TCP connection to
+// another, either through a JS pipe() or with socket.forward().
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  len: [64 * 1024, 1024 * 1024],
+  method: ['pipe', 'forward'],
+  dur: [5]
+}, {
+  test: { len: 64 * 1024 }
+});
+
+function main({ dur, len, method }) {
+  const chunk = Buffer.alloc(len, 'x');
+  let received = 0;
+
+  const sink = net.createServer((socket) => {
+    socket.on('data', (data) => {
+      received += data.length;
+    });
+  });
+
+  const proxy = net.createServer((client) => {
+    const upstream = net.connect(sink.address().port);
+    if (method === 'forward')
+      client.forward(upstream);
+    else
+      client.pipe(upstream);
+  });
+
+  sink.listen(0, () => {
+    proxy.listen(PORT, () => {
+      const socket = net.connect(PORT);
+      function write() {
+        while (socket.write(chunk));
+      }
+      socket.on('drain', write);
+      socket.on('connect', () => {
+        write();
+        bench.start();
+        setTimeout(() => {
+          const gbits = (received * 8) / (1024 * 1024 * 1024);
+          bench.end(gbits);
+          process.exit(0);
+        }, dur * 1000);
+      });
+    });
+  });
+}
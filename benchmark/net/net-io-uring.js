@@ -0,0 +1,61 @@
+// Test the rate of small writes from many sockets at once, when the writes are
+// submitted through io_uring (--experimental-io-uring) and through libuv.
+'use strict';
+
+const common = require('../common.js');
+const { fork } = require('child_process');
+const net = require('net');
+const PORT = common.PORT;
+
+if (process.argv[2] === 'writer') {
+  writer(+process.argv[3], +process.argv[4]);
+} else {
+  const bench = common.createBenchmark(main, {
+    connections: [1, 16, 128],
+    len: [128, 4096],
+    ioUring: [0, 1],
+    dur: [5]
+  }, {
+    test: { connections: 16 }
+  });
+
+  function main({ dur, connections, len, ioUring }) {
+    let received = 0;
+    let connected = 0;
+    let child;
+
+    const server = net.createServer((socket) => {
+      socket.on('data', (data) => {
+        received += data.length;
+      });
+      if (++connected !== connections)
+        return;
+      bench.start();
+      setTimeout(() => {
+        bench.end(received / len);
+        child.kill();
+        process.exit(0);
+      }, dur * 1000);
+    });
+
+    server.listen(PORT, () => {
+      child = fork(__filename, ['writer', connections, len], {
+        execArgv: ioUring ? ['--experimental-io-uring'] : []
+      });
+    });
+  }
+}
+
+function writer(connections, len) {
+  const message = Buffer.alloc(len, 'x');
+  for (let i = 0; i < connections; i++) {
+    const socket = net.connect(PORT);
+    const write = () => {
+      if (socket.write(message))
+        setImmediate(write);
+      else
+        socket.once('drain', write);
+    };
+    socket.on('connect', write);
+  }
+}
@@ -0,0 +1,53 @@
+// Test the speed of reading small chunks from many sockets, with and without
+// pooled read buffers.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  len: [64, 1024, 16 * 1024],
+  conns: [1, 100],
+  pooled: ['true', 'false'],
+  dur: [5],
+}, {
+  test: { len: 64, conns: 1 }
+});
+
+function main({ dur, len, conns, pooled }) {
+  const chunk = Buffer.alloc(len, 'x');
+  let received = 0;
+
+  const server = net.createServer({ pooledReads: pooled === 'true' },
+                                  (socket) => {
+                                    socket.on('data', (data) => {
+                                      received += data.length;
+                                    });
+                                  });
+
+  server.listen(PORT, () => {
+    let connected = 0;
+    for (let i = 0; i < conns; i++) {
+      const socket = net.connect(PORT, () => {
+        write(socket);
+        if (++connected === conns)
+          start();
+      });
+    }
+  });
+
+  function write(socket) {
+    // Write one chunk at a time so that reads stay small on the server side.
+    socket.write(chunk, () => setImmediate(write, socket));
+  }
+
+  function start() {
+    bench.start();
+    setTimeout(() => {
+      const gbits = (received * 8) / (1024 * 1024 * 1024);
+      bench.end(gbits);
+      process.exit(0);
+    }, dur * 1000);
+  }
+}
@@ -0,0 +1,73 @@
+// Test the speed of writev() with a mix of small header strings and large
+// bodies. Strings that are stored outside of the JS heap (e.g. large strings
+// created from Buffers) are written without being copied first.
+'use strict';
+
+const common = require('../common.js');
+const net = require('net');
+const PORT = common.PORT;
+
+const bench = common.createBenchmark(main, {
+  headers: [10],
+  len: [2 * 1024 * 1024, 16 * 1024 * 1024],
+  body: ['external', 'heap', 'buffer'],
+  encoding: ['latin1', 'utf8'],
+  dur: [5]
+}, {
+  test: { len: 2 * 1024 * 1024 }
+});
+
+function main({ dur, headers, len, body, encoding }) {
+  const headerLines = [];
+  for (let i = 0; i < headers; i++)
+    headerLines.push(`X-Header-${i}: value-${i}\r\n`);
+
+  let chunk;
+  switch (body) {
+    case 'external':
+      // Strings this large that are created from a Buffer are external.
+      chunk = Buffer.alloc(len, 'x').toString('latin1');
+      break;
+    case 'heap':
+      chunk = 'x'.repeat(len);
+      break;
+    case 'buffer':
+      chunk = Buffer.alloc(len, 'x');
+      break;
+    default:
+      throw new Error(`invalid body: ${body}`);
+  }
+
+  const server = net.createServer((socket) => {
+    function write() {
+      socket.cork();
+      socket.write('HTTP/1.1 200 OK\r\n', encoding);
+      for (let i = 0; i < headerLines.length; i++)
+        socket.write(headerLines[i], encoding);
+      socket.write('\r\n', encoding);
+      const ret = socket.write(chunk, encoding);
+      socket.uncork();
+      if (ret)
+        setImmediate(write);
+      else
+        socket.once('drain', write);
+    }
+    write();
+  });
+
+  server.listen(PORT, () => {
+    let received = 0;
+    const socket = net.connect(PORT);
+    socket.on('data', (data) => {
+      received += data.length;
+    });
+    socket.on('connect', () => {
+      bench.start();
+      setTimeout(() => {
+        const gbits = (received * 8) / (1024 * 1024 * 1024);
+        bench.end(gbits);
+        process.exit(0);
+      }, dur * 1000);
+    });
+  });
+}
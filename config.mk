@@ -0,0 +1,5 @@
+# Do not edit. Generated by the configure script.
+BUILDTYPE=Release
+NODE_TARGET_TYPE=executable
+PYTHON=/root/.pyenv/versions/3.9.18/bin/python3.9
+PREFIX=/usr/local
@@ -23,6 +23,7 @@
 
 const {
   ArrayPrototypeConcat,
+  FunctionPrototypeCall,
   MathMin,
   Symbol,
   RegExpPrototypeTest,
@@ -38,6 +39,7 @@ const FreeList = require('internal/freelist');
 const incoming = require('_http_incoming');
 const {
   IncomingMessage,
+  addHeaderBlock,
   readStart,
   readStop
 } = incoming;
@@ -54,6 +56,7 @@ const kOnBody = HTTPParser.kOnBody | 0;
 const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
 const kOnExecute = HTTPParser.kOnExecute | 0;
 const kOnTimeout = HTTPParser.kOnTimeout | 0;
+const kOnMessage = HTTPParser.kOnMessage | 0;
 
 const MAX_HEADER_PAIRS = 2000;
 
@@ -75,9 +78,12 @@ function parserOnHeaders(headers, url) {
 // this request.
 // `url` is not set for response parsers but that's not applicable here since
 // all our parsers are request parsers.
+// `headerBlock` is only set when the parser was initialized with flat headers.
+// It holds the bytes of all fields and values, and `headers` is a Uint32Array
+// with their start and end offsets in it.
 function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
                                  url, statusCode, statusMessage, upgrade,
-                                 shouldKeepAlive) {
+                                 shouldKeepAlive, headerBlock) {
   const parser = this;
   const { socket } = parser;
 
@@ -109,13 +115,16 @@ function parserOnHeadersComplete(versionMajor, versionMinor, headers, method,
     incoming.socket[kRequestTimeout] = undefined;
   }
 
-  let n = headers.length;
+  let n = headerBlock !== undefined ? headers.length / 2 : headers.length;
 
   // If parser.maxHeaderPairs <= 0 assume that there's no limit.
   if (parser.maxHeaderPairs > 0)
     n = MathMin(n, parser.maxHeaderPairs);
 
-  incoming._addHeaderLines(headers, n);
+  if (headerBlock !== undefined)
+    addHeaderBlock(incoming, headerBlock, headers, n);
+  else
+    incoming._addHeaderLines(headers, n);
 
   if (typeof method === 'number') {
     // server only
@@ -167,6 +176,22 @@ function parserOnMessageComplete() {
   readStart(parser.socket);
 }
 
+// Called instead of the callbacks above for a request that the parser has
+// received completely, i.e. one without a body, or with a body that arrived
+// in the same chunk of data as the end of the headers. `body` is only set in
+// the latter case, and parserOnMessageComplete() is then called separately.
+function parserOnMessage(versionMajor, versionMinor, headers, method, url,
+                         statusCode, statusMessage, upgrade, shouldKeepAlive,
+                         headerBlock, body, bodyStart, bodyLength) {
+  FunctionPrototypeCall(parserOnHeadersComplete, this, versionMajor,
+                        versionMinor, headers, method, url, statusCode,
+                        statusMessage, upgrade, shouldKeepAlive, headerBlock);
+  if (body !== undefined)
+    FunctionPrototypeCall(parserOnBody, this, body, bodyStart, bodyLength);
+  else
+    FunctionPrototypeCall(parserOnMessageComplete, this);
+}
+
 
 const parsers = new FreeList('parsers', 1000, function parsersCb() {
   const parser = new HTTPParser();
@@ -177,6 +202,7 @@ const parsers = new FreeList('parsers', 1000, function parsersCb() {
   parser[kOnHeadersComplete] = parserOnHeadersComplete;
   parser[kOnBody] = parserOnBody;
   parser[kOnMessageComplete] = parserOnMessageComplete;
+  parser[kOnMessage] = parserOnMessage;
 
   return parser;
 });
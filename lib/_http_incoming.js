@@ -22,6 +22,7 @@
 'use strict';
 
 const {
+  Array,
   ArrayPrototypePush,
   FunctionPrototypeCall,
   ObjectDefineProperty,
@@ -38,6 +39,9 @@ const kHeaders = Symbol('kHeaders');
 const kHeadersCount = Symbol('kHeadersCount');
 const kTrailers = Symbol('kTrailers');
 const kTrailersCount = Symbol('kTrailersCount');
+const kHeaderBlock = Symbol('kHeaderBlock');
+const kHeaderOffsets = Symbol('kHeaderOffsets');
+const kRawHeaders = Symbol('kRawHeaders');
 
 function readStart(socket) {
   if (socket && !socket._paused && socket.readable)
@@ -186,6 +190,68 @@ IncomingMessage.prototype._destroy = function _destroy(err, cb) {
   }
 };
 
+// Used instead of a plain `rawHeaders` property for messages whose headers
+// were received as a single block, see addHeaderBlock().
+const lazyRawHeadersDescriptor = {
+  configurable: true,
+  enumerable: true,
+  get() {
+    if (this[kRawHeaders] === undefined) {
+      const block = this[kHeaderBlock];
+      const offsets = this[kHeaderOffsets];
+      const rawHeaders = new Array(this[kHeadersCount]);
+      for (let i = 0; i < rawHeaders.length; i++)
+        rawHeaders[i] = block.latin1Slice(offsets[i * 2], offsets[i * 2 + 1]);
+      this[kRawHeaders] = rawHeaders;
+    }
+    return this[kRawHeaders];
+  },
+  set(val) {
+    this[kRawHeaders] = val;
+  }
+};
+
+// Sets the headers of `msg` from a block of bytes that holds all fields and
+// values. `offsets` contains the start and end offsets of each field and
+// value in `block`, and `n` is the number of fields and values to use. The
+// strings are created when `rawHeaders` or `headers` is first accessed.
+function addHeaderBlock(msg, block, offsets, n) {
+  msg[kHeaderBlock] = block;
+  msg[kHeaderOffsets] = offsets;
+  msg[kHeadersCount] = n;
+  msg[kRawHeaders] = undefined;
+  ObjectDefineProperty(msg, 'rawHeaders', lazyRawHeadersDescriptor);
+}
+
+// Returns `msg.headers[name]`, without creating the strings of the other
+// headers if they were added with addHeaderBlock(). `name` must only consist
+// of lowercase letters.
+function getIncomingHeader(msg, name) {
+  const block = msg[kHeaderBlock];
+  if (block === undefined || msg[kHeaders] || msg[kRawHeaders] !== undefined)
+    return msg.headers[name];
+
+  const offsets = msg[kHeaderOffsets];
+  let value;
+  for (let i = 0; i < msg[kHeadersCount]; i += 2) {
+    const start = offsets[i * 2];
+    if (offsets[i * 2 + 1] - start !== name.length)
+      continue;
+    let j = 0;
+    while (j < name.length &&
+           (block[start + j] | 0x20) === StringPrototypeCharCodeAt(name, j)) {
+      j++;
+    }
+    if (j !== name.length)
+      continue;
+    // Repeated headers are joined or dropped, see _addHeaderLine().
+    if (value !== undefined)
+      return msg.headers[name];
+    value = block.latin1Slice(offsets[i * 2 + 2], offsets[i * 2 + 3]);
+  }
+  return value;
+}
+
 IncomingMessage.prototype._addHeaderLines = _addHeaderLines;
 function _addHeaderLines(headers, n) {
   if (headers && headers.length) {
@@ -374,6 +440,8 @@ function onError(self, error, cb) {
 
 module.exports = {
   IncomingMessage,
+  addHeaderBlock,
+  getIncomingHeader,
   readStart,
   readStop
 };
@@ -50,6 +50,7 @@ const internalUtil = require('internal/util');
 const { kOutHeaders, utcDate, kNeedDrain } = require('internal/http');
 const { Buffer } = require('buffer');
 const common = require('_http_common');
+const { serializeHeaders } = internalBinding('http_parser');
 const checkIsHttpToken = common._checkIsHttpToken;
 const checkInvalidHeaderChar = common._checkInvalidHeaderChar;
 const {
@@ -66,6 +67,7 @@ const {
     ERR_INVALID_ARG_VALUE,
     ERR_INVALID_CHAR,
     ERR_METHOD_NOT_IMPLEMENTED,
+    ERR_MISSING_OPTION,
     ERR_STREAM_CANNOT_PIPE,
     ERR_STREAM_ALREADY_FINISHED,
     ERR_STREAM_WRITE_AFTER_END,
@@ -74,7 +76,11 @@ const {
   },
   hideStackFrames
 } = require('internal/errors');
-const { validateString } = require('internal/validators');
+const {
+  validateFunction,
+  validateString
+} = require('internal/validators');
+const { createSendFileChunk, kSendFile } = require('internal/net');
 const { isUint8Array } = require('internal/util/types');
 
 const HIGH_WATER_MARK = getDefaultHighWaterMark();
@@ -379,20 +385,24 @@ function _storeHeader(firstLine, headers) {
     te: false,
     date: false,
     expect: false,
-    trailer: false,
-    header: firstLine
+    trailer: false
   };
+  // Names and values of the header fields, in the order in which they are
+  // sent.
+  const fields = [];
+  // The fields in this[kOutHeaders] have been validated by setHeader().
+  const validate = headers !== this[kOutHeaders];
 
   if (headers) {
-    if (headers === this[kOutHeaders]) {
+    if (!validate) {
       for (const key in headers) {
         const entry = headers[key];
-        processHeader(this, state, entry[0], entry[1], false);
+        processHeader(fields, entry[0], entry[1], false);
       }
     } else if (ArrayIsArray(headers)) {
       if (headers.length && ArrayIsArray(headers[0])) {
         ArrayPrototypeForEach(headers, (entry) =>
-          processHeader(this, state, entry[0], entry[1], true)
+          processHeader(fields, entry[0], entry[1], true)
         );
       } else {
         if (headers.length % 2 !== 0) {
@@ -400,19 +410,27 @@ function _storeHeader(firstLine, headers) {
         }
 
         for (let n = 0; n < headers.length; n += 2) {
-          processHeader(this, state, headers[n + 0], headers[n + 1], true);
+          processHeader(fields, headers[n + 0], headers[n + 1], true);
         }
       }
     } else {
       for (const key in headers) {
         if (ObjectPrototypeHasOwnProperty(headers, key)) {
-          processHeader(this, state, key, headers[key], true);
+          processHeader(fields, key, headers[key], true);
         }
       }
     }
   }
 
-  let { header } = state;
+  // Validate the fields and write them after the start line in one go.
+  let header = serializeHeaders(firstLine, fields, validate);
+  if (typeof header === 'number') {
+    validateHeaderName(fields[header]);
+    validateHeaderValue(fields[header], fields[header + 1]);
+  }
+
+  for (let n = 0; n < fields.length; n += 2)
+    matchHeader(this, state, fields[n], fields[n + 1]);
 
   // Date header
   if (this.sendDate && !state.date) {
@@ -495,27 +513,32 @@ function _storeHeader(firstLine, headers) {
   if (state.expect) this._send('');
 }
 
-function processHeader(self, state, key, value, validate) {
-  if (validate)
-    validateHeaderName(key);
+function processHeader(fields, key, value, validate) {
   if (ArrayIsArray(value)) {
-    if (value.length < 2 || !isCookieField(key)) {
+    // serializeHeaders() only validates the names of the fields it is given.
+    if (value.length === 0) {
+      if (validate)
+        validateHeaderName(key);
+      return;
+    }
+    if (value.length < 2 || typeof key !== 'string' || !isCookieField(key)) {
       // Retain for(;;) loop for performance reasons
       // Refs: https://github.com/nodejs/node/pull/30958
       for (let i = 0; i < value.length; i++)
-        storeHeader(self, state, key, value[i], validate);
+        storeHeader(fields, key, value[i], validate);
       return;
     }
     value = ArrayPrototypeJoin(value, '; ');
   }
-  storeHeader(self, state, key, value, validate);
+  storeHeader(fields, key, value, validate);
 }
 
-function storeHeader(self, state, key, value, validate) {
-  if (validate)
-    validateHeaderValue(key, value);
-  state.header += key + ': ' + value + CRLF;
-  matchHeader(self, state, key, value);
+function storeHeader(fields, key, value, validate) {
+  // serializeHeaders() only accepts strings. `undefined` is left for it to
+  // reject, so that validateHeaderValue() reports it.
+  if (typeof value !== 'string' && (value !== undefined || !validate))
+    value = '' + value;
+  ArrayPrototypePush(fields, key, value);
 }
 
 function matchHeader(self, state, field, value) {
@@ -773,6 +796,76 @@ function write_(msg, chunk, encoding, callback, fromEnd) {
 }
 
 
+// Writes a range of a file as part of the body. On plain TCP connections, the
+// file is sent with sendfile() instead of being read into JS.
+OutgoingMessage.prototype.sendFile = function sendFile(file, options,
+                                                       callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  else
+    callback = nop;
+
+  let err;
+  if (this.finished) {
+    err = new ERR_STREAM_WRITE_AFTER_END();
+  } else if (this.destroyed) {
+    err = new ERR_STREAM_DESTROYED('sendFile');
+  }
+  if (err) {
+    if (!this.destroyed) {
+      onError(this, err, callback);
+    } else {
+      process.nextTick(callback, err);
+    }
+    return false;
+  }
+
+  const { chunk, done } = createSendFileChunk(file, options);
+  const { length } = chunk[kSendFile];
+
+  if (!this._header)
+    this._implicitHeader();
+
+  // The size of a chunk is sent before its data. It is not looked up here,
+  // because that would block the event loop.
+  if (length < 0 && this._hasBody && this.chunkedEncoding) {
+    done();
+    throw new ERR_MISSING_OPTION('options.length');
+  }
+
+  if (!this._hasBody || length === 0) {
+    done();
+    process.nextTick(callback);
+    return true;
+  }
+
+  if (this.socket && !this.socket.writableCorked) {
+    this.socket.cork();
+    process.nextTick(connectionCorkNT, this.socket);
+  }
+
+  let ret;
+  if (this.chunkedEncoding) {
+    this._send(NumberPrototypeToString(length, 16), 'latin1', null);
+    this._send(crlf_buf, null, null);
+    this._send(chunk, null, done);
+    ret = this._send(crlf_buf, null, callback);
+  } else {
+    ret = this._send(chunk, null, (err) => {
+      done();
+      callback(err);
+    });
+  }
+  if (!ret)
+    this[kNeedDrain] = true;
+  return ret;
+};
+
+
 function connectionCorkNT(conn) {
   conn.uncork();
 }
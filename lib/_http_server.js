@@ -66,7 +66,10 @@ const {
   defaultTriggerAsyncIdScope,
   getOrSetAsyncId
 } = require('internal/async_hooks');
-const { IncomingMessage } = require('_http_incoming');
+const {
+  IncomingMessage,
+  getIncomingHeader,
+} = require('_http_incoming');
 const {
   connResetException,
   codes
@@ -188,8 +191,8 @@ function ServerResponse(req) {
   this._expect_continue = false;
 
   if (req.httpVersionMajor < 1 || req.httpVersionMinor < 1) {
-    this.useChunkedEncodingByDefault = RegExpPrototypeTest(chunkExpression,
-                                                           req.headers.te);
+    this.useChunkedEncodingByDefault =
+      RegExpPrototypeTest(chunkExpression, getIncomingHeader(req, 'te'));
     this.shouldKeepAlive = false;
   }
 
@@ -382,6 +385,11 @@ function Server(options, requestListener) {
     validateBoolean(insecureHTTPParser, 'options.insecureHTTPParser');
   this.insecureHTTPParser = insecureHTTPParser;
 
+  const lazyHeaders = options.lazyHeaders;
+  if (lazyHeaders !== undefined)
+    validateBoolean(lazyHeaders, 'options.lazyHeaders');
+  this.lazyHeaders = lazyHeaders;
+
   FunctionPrototypeCall(net.Server, this, { allowHalfOpen: true });
 
   if (requestListener) {
@@ -464,6 +472,7 @@ function connectionListenerInternal(server, socket) {
     server.insecureHTTPParser === undefined ?
       isLenient() : server.insecureHTTPParser,
     server.headersTimeout || 0,
+    server.lazyHeaders === true,
   );
   parser.socket = socket;
   socket.parser = parser;
@@ -898,9 +907,10 @@ function parserOnIncoming(server, socket, state, req, keepAlive) {
          FunctionPrototypeBind(resOnFinish, undefined,
                                req, res, socket, state, server));
 
-  if (req.headers.expect !== undefined &&
+  const expect = getIncomingHeader(req, 'expect');
+  if (expect !== undefined &&
       (req.httpVersionMajor === 1 && req.httpVersionMinor === 1)) {
-    if (RegExpPrototypeTest(continueExpression, req.headers.expect)) {
+    if (RegExpPrototypeTest(continueExpression, expect)) {
       res._expect_continue = true;
 
       if (server.listenerCount('checkContinue') > 0) {
@@ -53,9 +53,11 @@ const {
 const {
   isInt32,
   validateAbortSignal,
+  validateBoolean,
   validateString,
   validateNumber,
   validatePort,
+  validateUint32,
 } = require('internal/validators');
 const { Buffer } = require('buffer');
 const { deprecate } = require('internal/util');
@@ -96,6 +98,8 @@ function Socket(type, listener) {
   let lookup;
   let recvBufferSize;
   let sendBufferSize;
+  let recvBatch = false;
+  let recvGRO = false;
 
   let options;
   if (type !== null && typeof type === 'object') {
@@ -104,9 +108,17 @@ function Socket(type, listener) {
     lookup = options.lookup;
     recvBufferSize = options.recvBufferSize;
     sendBufferSize = options.sendBufferSize;
+    if (options.recvBatch !== undefined) {
+      validateBoolean(options.recvBatch, 'options.recvBatch');
+      recvBatch = options.recvBatch;
+    }
+    if (options.recvGRO !== undefined) {
+      validateBoolean(options.recvGRO, 'options.recvGRO');
+      recvGRO = options.recvGRO;
+    }
   }
 
-  const handle = newHandle(type, lookup);
+  const handle = newHandle(type, lookup, recvBatch);
   handle[owner_symbol] = this;
 
   this[async_id_symbol] = handle.getAsyncId();
@@ -124,7 +136,9 @@ function Socket(type, listener) {
     reuseAddr: options && options.reuseAddr, // Use UV_UDP_REUSEADDR if true.
     ipv6Only: options && options.ipv6Only,
     recvBufferSize,
-    sendBufferSize
+    sendBufferSize,
+    recvBatch,
+    recvGRO
   };
 
   if (options?.signal !== undefined) {
@@ -154,6 +168,14 @@ function startListening(socket) {
   const state = socket[kStateSymbol];
 
   state.handle.onmessage = onMessage;
+  if (state.recvBatch) {
+    state.handle.onmessagebatch = onMessageBatch;
+    state.handle.setRecvBatch(true);
+  }
+  // GRO only changes how datagrams are read, so it is fine to go without it
+  // where it is not supported.
+  if (state.recvGRO)
+    state.handle.enableGRO();
   // Todo: handle errors
   state.handle.recvStart();
   state.receiving = true;
@@ -176,6 +198,7 @@ function replaceHandle(self, newHandle) {
   newHandle.lookup = oldHandle.lookup;
   newHandle.bind = oldHandle.bind;
   newHandle.send = oldHandle.send;
+  newHandle.sendBatch = oldHandle.sendBatch;
   newHandle[owner_symbol] = self;
 
   // Replace the existing handle by the handle we got from primary.
@@ -715,6 +738,127 @@ function doSend(ex, self, ip, list, address, port, callback) {
   }
 }
 
+// sendBatch(list, port, address, callback)
+// sendBatch(list, port, address)
+// sendBatch(list, port, callback)
+// sendBatch(list, port)
+// For connected sockets
+// sendBatch(list, callback)
+// sendBatch(list)
+Socket.prototype.sendBatch = function(list, port, address, callback) {
+  const state = this[kStateSymbol];
+  const connected = state.connectState === CONNECT_STATE_CONNECTED;
+
+  if (typeof port === 'function') {
+    callback = port;
+    port = undefined;
+  } else if (typeof address === 'function') {
+    callback = address;
+    address = undefined;
+  }
+
+  let buffers;
+  if (!ArrayIsArray(list) || !(buffers = fixBufferList(list))) {
+    throw new ERR_INVALID_ARG_TYPE('list',
+                                   'an Array of Buffer, TypedArray, ' +
+                                   'DataView or string',
+                                   list);
+  }
+
+  if (connected) {
+    if (port !== undefined || address !== undefined)
+      throw new ERR_SOCKET_DGRAM_IS_CONNECTED();
+  } else {
+    port = validatePort(port, 'Port', { allowZero: false });
+  }
+
+  if (typeof callback !== 'function')
+    callback = undefined;
+
+  if (address && typeof address !== 'string')
+    throw new ERR_INVALID_ARG_TYPE('address', ['string', 'falsy'], address);
+
+  healthCheck(this);
+
+  if (state.bindState === BIND_STATE_UNBOUND)
+    this.bind({ port: 0, exclusive: true }, null);
+
+  if (state.bindState !== BIND_STATE_BOUND) {
+    enqueue(this, FunctionPrototypeBind(this.sendBatch, this,
+                                        buffers, port, address, callback));
+    return;
+  }
+
+  const afterDns = (ex, ip) => {
+    defaultTriggerAsyncIdScope(
+      this[async_id_symbol],
+      doSendBatch,
+      ex, this, ip, buffers, address, port, callback
+    );
+  };
+
+  if (!connected) {
+    state.handle.lookup(address, afterDns);
+  } else {
+    afterDns(null, null);
+  }
+};
+
+function doSendBatch(ex, self, ip, list, address, port, callback) {
+  const state = self[kStateSymbol];
+
+  if (ex || !state.handle) {
+    doSend(ex, self, ip, list, address, port, callback);
+    return;
+  }
+
+  if (list.length === 0) {
+    if (callback)
+      process.nextTick(callback, null, 0);
+    return;
+  }
+
+  // Datagrams that cannot be sent in one go, e.g. because the socket's send
+  // buffer is full, are sent one by one.
+  let sent;
+  if (port)
+    sent = state.handle.sendBatch(list, list.length, port, ip);
+  else
+    sent = state.handle.sendBatch(list, list.length);
+
+  if (sent < 0) {
+    if (callback) {
+      const ex = exceptionWithHostPort(sent, 'send', address, port);
+      process.nextTick(callback, ex);
+    }
+    return;
+  }
+
+  let bytes = 0;
+  for (let i = 0; i < sent; i++)
+    bytes += list[i].length;
+
+  let pending = list.length - sent;
+  if (pending === 0) {
+    if (callback)
+      process.nextTick(callback, null, bytes);
+    return;
+  }
+
+  let error = null;
+  const afterEach = callback && ((err, n) => {
+    if (err)
+      error = error || err;
+    else
+      bytes += n;
+    if (--pending === 0)
+      callback(error, error ? undefined : bytes);
+  });
+
+  for (let i = sent; i < list.length; i++)
+    doSend(null, self, ip, [list[i]], address, port, afterEach);
+}
+
 function afterSend(err, sent) {
   if (err) {
     err = exceptionWithHostPort(err, 'send', this.address, this.port);
@@ -803,6 +947,18 @@ Socket.prototype.setTTL = function(ttl) {
 };
 
 
+Socket.prototype.setSendSegmentSize = function(size) {
+  validateUint32(size, 'size');
+
+  const err = this[kStateSymbol].handle.setSendSegmentSize(size);
+  if (err) {
+    throw errnoException(err, 'setSendSegmentSize');
+  }
+
+  return size;
+};
+
+
 Socket.prototype.setMulticastTTL = function(ttl) {
   validateNumber(ttl, 'ttl');
 
@@ -931,6 +1087,12 @@ function onMessage(nread, handle, buf, rinfo) {
 }
 
 
+function onMessageBatch(handle, buf, offsets, addresses) {
+  const self = handle[owner_symbol];
+  self.emit('messagebatch', buf, offsets, addresses);
+}
+
+
 Socket.prototype.ref = function() {
   const handle = this[kStateSymbol].handle;
 
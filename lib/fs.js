@@ -33,6 +33,7 @@ const kIoMaxLength = 2 ** 31 - 1;
 // in case they are created but never used due to an exception.
 
 const {
+  ArrayPrototypeMap,
   ArrayPrototypePush,
   BigIntPrototypeToString,
   MathMax,
@@ -91,17 +92,20 @@ const {
   getOptions,
   getValidatedFd,
   getValidatedPath,
+  getValidatedPaths,
   getValidMode,
   handleErrorFromBinding,
   nullCheck,
   preprocessSymlinkDestination,
   Stats,
   getStatsFromBinding,
+  getStatsManyFromBinding,
   realpathCacheKey,
   stringToFlags,
   stringToSymlinkType,
   toUnixTimestamp,
   validateBufferArray,
+  validateCpOptions,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validatePath,
@@ -115,7 +119,8 @@ const {
 const {
   Dir,
   opendir,
-  opendirSync
+  opendirSync,
+  walk
 } = require('internal/fs/dir');
 const {
   CHAR_FORWARD_SLASH,
@@ -320,9 +325,40 @@ function readFileAfterStat(err, stats) {
   context.read();
 }
 
+function readFileAfterReadFile(err, data) {
+  const { callback, encoding } = this;
+
+  if (err)
+    return callback(err);
+  // The binding reports the size of files that are too large to be read.
+  if (typeof data === 'number')
+    return callback(new ERR_FS_FILE_TOO_LARGE(data));
+  if (encoding && typeof data !== 'string')
+    data = data.toString(encoding);
+  callback(null, data);
+}
+
 function readFile(path, options, callback) {
   callback = maybeCallback(callback || options);
   options = getOptions(options, { flag: 'r' });
+  if (!options.signal && !isFd(path)) {
+    // Without a signal to check between reads, the file is opened, read and
+    // closed with a single request.
+    const { encoding } = options;
+    const flagsNumber = stringToFlags(options.flag);
+    path = getValidatedPath(path);
+
+    const req = new FSReqCallback();
+    req.callback = callback;
+    req.encoding = encoding;
+    req.oncomplete = readFileAfterReadFile;
+    binding.readFile(pathModule.toNamespacedPath(path),
+                     flagsNumber,
+                     encoding === 'utf8' || encoding === 'utf-8',
+                     req);
+    return;
+  }
+
   if (!ReadFileContext)
     ReadFileContext = require('internal/fs/read_file_context');
   const context = new ReadFileContext(callback, options.encoding);
@@ -1088,6 +1124,39 @@ function stat(path, options = { bigint: false }, callback) {
   binding.stat(pathModule.toNamespacedPath(path), options.bigint, req);
 }
 
+function statManyAfterStat(err, result) {
+  const { callback, paths, syscall } = this;
+
+  if (err)
+    return callback(err);
+  callback(null, getStatsManyFromBinding(result, paths, syscall));
+}
+
+function statManyImpl(syscall, paths, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = {};
+  }
+  callback = maybeCallback(callback);
+  paths = getValidatedPaths(paths);
+
+  const req = new FSReqCallback(options.bigint);
+  req.callback = callback;
+  req.paths = paths;
+  req.syscall = syscall;
+  req.oncomplete = statManyAfterStat;
+  binding.statMany(ArrayPrototypeMap(paths, pathModule.toNamespacedPath),
+                   syscall === 'lstat', options.bigint, req);
+}
+
+function lstatMany(paths, options = { bigint: false }, callback) {
+  statManyImpl('lstat', paths, options, callback);
+}
+
+function statMany(paths, options = { bigint: false }, callback) {
+  statManyImpl('stat', paths, options, callback);
+}
+
 function hasNoEntryError(ctx) {
   if (ctx.errno) {
     const uvErr = uvErrmapGet(ctx.errno);
@@ -2054,6 +2123,46 @@ function copyFileSync(src, dest, mode) {
   handleErrorFromBinding(ctx);
 }
 
+function cp(src, dest, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+
+  src = getValidatedPath(src, 'src');
+  dest = getValidatedPath(dest, 'dest');
+  options = validateCpOptions(src, dest, options);
+  callback = makeCallback(callback);
+
+  const req = new FSReqCallback();
+  req.oncomplete = callback;
+  binding.cpTree(pathModule.toNamespacedPath(src),
+                 pathModule.toNamespacedPath(dest),
+                 options.recursive,
+                 options.mode,
+                 options.force,
+                 options.errorOnExist,
+                 req);
+}
+
+function cpSync(src, dest, options) {
+  src = getValidatedPath(src, 'src');
+  dest = getValidatedPath(dest, 'dest');
+  options = validateCpOptions(src, dest, options);
+
+  // The path of the entry that failed is set by the binding.
+  const ctx = {};
+  binding.cpTree(pathModule.toNamespacedPath(src),
+                 pathModule.toNamespacedPath(dest),
+                 options.recursive,
+                 options.mode,
+                 options.force,
+                 options.errorOnExist,
+                 undefined,
+                 ctx);
+  handleErrorFromBinding(ctx);
+}
+
 function lazyLoadStreams() {
   if (!ReadStream) {
     ({ ReadStream, WriteStream } = require('internal/fs/streams'));
@@ -2084,6 +2193,8 @@ module.exports = fs = {
   closeSync,
   copyFile,
   copyFileSync,
+  cp,
+  cpSync,
   createReadStream,
   createWriteStream,
   exists,
@@ -2109,6 +2220,7 @@ module.exports = fs = {
   link,
   linkSync,
   lstat,
+  lstatMany,
   lstatSync,
   lutimes,
   lutimesSync,
@@ -2139,6 +2251,7 @@ module.exports = fs = {
   rmdir,
   rmdirSync,
   stat,
+  statMany,
   statSync,
   symlink,
   symlinkSync,
@@ -2149,6 +2262,7 @@ module.exports = fs = {
   unlinkSync,
   utimes,
   utimesSync,
+  walk,
   watch,
   watchFile,
   writeFile,
@@ -153,6 +153,7 @@ const rawMethods = internalBinding('process_methods');
   process._rawDebug = wrapped._rawDebug;
   process.cpuUsage = wrapped.cpuUsage;
   process.resourceUsage = wrapped.resourceUsage;
+  process.threadpoolUsage = wrapped.threadpoolUsage;
   process.memoryUsage = wrapped.memoryUsage;
   process.kill = wrapped.kill;
   process.exit = wrapped.exit;
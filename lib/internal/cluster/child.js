@@ -10,11 +10,13 @@ const {
 } = primordials;
 
 const assert = require('internal/assert');
+const net = require('net');
 const path = require('path');
 const EventEmitter = require('events');
 const { owner_symbol } = require('internal/async_hooks').symbols;
 const Worker = require('internal/cluster/worker');
 const { internal, sendHelper } = require('internal/cluster/utils');
+const { constants: TCPConstants } = internalBinding('tcp_wrap');
 const cluster = new EventEmitter();
 const handles = new SafeMap();
 const indexes = new SafeMap();
@@ -103,6 +105,8 @@ cluster._getServer = function(obj, options, cb) {
 
     if (handle)
       shared(reply, handle, indexesKey, index, cb);  // Shared listen socket.
+    else if (reply.reusePort)
+      reusePort(reply, options, indexesKey, index, cb);  // Own listen socket.
     else
       rr(reply, indexesKey, index, cb);              // Round-robin.
   });
@@ -146,6 +150,25 @@ function shared(message, handle, indexesKey, index, cb) {
   cb(message.errno, handle);
 }
 
+// SO_REUSEPORT. Every worker listens on a socket of its own and the kernel
+// distributes connections. The primary resolves the port number.
+function reusePort(message, options, indexesKey, index, cb) {
+  if (message.errno)
+    return cb(message.errno, null);
+
+  const handle = net._createServerHandle(options.address, message.port,
+                                         options.addressType, options.fd,
+                                         options.flags |
+                                         TCPConstants.REUSEPORT);
+  if (typeof handle === 'number') {
+    send({ act: 'close', key: message.key });
+    removeIndexesKey(indexesKey, index);
+    return cb(handle, null);
+  }
+
+  shared(message, handle, indexesKey, index, cb);
+}
+
 // Round-robin. Primary distributes handles across workers.
 function rr(message, indexesKey, index, cb) {
   if (message.errno)
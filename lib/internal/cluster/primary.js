@@ -15,6 +15,7 @@ const assert = require('internal/assert');
 const { fork } = require('child_process');
 const path = require('path');
 const EventEmitter = require('events');
+const ReusePortHandle = require('internal/cluster/reuseport_handle');
 const RoundRobinHandle = require('internal/cluster/round_robin_handle');
 const SharedHandle = require('internal/cluster/shared_handle');
 const Worker = require('internal/cluster/worker');
@@ -23,6 +24,7 @@ const cluster = new EventEmitter();
 const intercom = new EventEmitter();
 const SCHED_NONE = 1;
 const SCHED_RR = 2;
+const SCHED_REUSEPORT = 3;
 const [ minPort, maxPort ] = [ 1024, 65535 ];
 const { validatePort } = require('internal/validators');
 
@@ -37,6 +39,7 @@ cluster.workers = {};
 cluster.settings = {};
 cluster.SCHED_NONE = SCHED_NONE;  // Leave it to the operating system.
 cluster.SCHED_RR = SCHED_RR;      // Primary distributes connections.
+cluster.SCHED_REUSEPORT = SCHED_REUSEPORT;  // Workers listen with SO_REUSEPORT.
 
 let ids = 0;
 let debugPortOffset = 1;
@@ -48,6 +51,8 @@ if (schedulingPolicy === 'rr')
   schedulingPolicy = SCHED_RR;
 else if (schedulingPolicy === 'none')
   schedulingPolicy = SCHED_NONE;
+else if (schedulingPolicy === 'reuseport')
+  schedulingPolicy = SCHED_REUSEPORT;
 else if (process.platform === 'win32') {
   // Round-robin doesn't perform well on
   // Windows due to the way IOCP is wired up.
@@ -85,7 +90,8 @@ cluster.setupPrimary = function(options) {
 
   initialized = true;
   schedulingPolicy = cluster.schedulingPolicy;  // Freeze policy.
-  assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR,
+  assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR ||
+         schedulingPolicy === SCHED_REUSEPORT,
          `Bad cluster.schedulingPolicy: ${schedulingPolicy}`);
 
   process.nextTick(setupSettingsNT, settings);
@@ -306,9 +312,13 @@ function queryServer(worker, message) {
     // UDP is exempt from round-robin connection balancing for what should
     // be obvious reasons: it's connectionless. There is nothing to send to
     // the workers except raw datagrams and that's pointless.
-    if (schedulingPolicy !== SCHED_RR ||
-        message.addressType === 'udp4' ||
-        message.addressType === 'udp6') {
+    if (schedulingPolicy === SCHED_REUSEPORT &&
+        (message.addressType === 4 || message.addressType === 6) &&
+        !(message.fd >= 0)) {
+      constructor = ReusePortHandle;
+    } else if (schedulingPolicy !== SCHED_RR ||
+               message.addressType === 'udp4' ||
+               message.addressType === 'udp6') {
       constructor = SharedHandle;
     }
 
@@ -0,0 +1,53 @@
+'use strict';
+const { SafeMap } = primordials;
+const assert = require('internal/assert');
+const net = require('net');
+const { constants } = internalBinding('tcp_wrap');
+
+module.exports = ReusePortHandle;
+
+// Every worker binds and listens on its own SO_REUSEPORT socket, and the
+// kernel balances incoming connections between them. The primary only holds
+// a bound but not listening socket so that all workers agree on the port when
+// listening on port 0, and so that the port is not taken by an unrelated
+// process while workers are restarted. The kernel never routes connections
+// to a socket that is not listening.
+function ReusePortHandle(key, address, { port, addressType, fd, flags }) {
+  this.key = key;
+  this.workers = new SafeMap();
+  this.handle = null;
+  this.errno = 0;
+  this.port = port;
+
+  const rval = net._createServerHandle(address, port, addressType, fd,
+                                       flags | constants.REUSEPORT);
+
+  if (typeof rval === 'number') {
+    this.errno = rval;
+  } else {
+    this.handle = rval;
+    const out = {};
+    this.handle.getsockname(out);
+    this.port = out.port;
+  }
+}
+
+ReusePortHandle.prototype.add = function(worker, send) {
+  assert(!this.workers.has(worker.id));
+  this.workers.set(worker.id, worker);
+  send(this.errno, { reusePort: true, port: this.port }, null);
+};
+
+ReusePortHandle.prototype.remove = function(worker) {
+  if (!this.workers.has(worker.id))
+    return false;
+
+  this.workers.delete(worker.id);
+
+  if (this.workers.size !== 0)
+    return false;
+
+  this.handle.close();
+  this.handle = null;
+  return true;
+};
@@ -6,7 +6,10 @@ const {
 } = primordials;
 
 const { codes } = require('internal/errors');
-const { UDP } = internalBinding('udp_wrap');
+const {
+  constants: { UV_UDP_RECVMMSG },
+  UDP,
+} = internalBinding('udp_wrap');
 const { guessHandleType } = internalBinding('util');
 const {
   isInt32,
@@ -29,7 +32,7 @@ function lookup6(lookup, address, callback) {
   return lookup(address || '::1', 6, callback);
 }
 
-function newHandle(type, lookup) {
+function newHandle(type, lookup, recvBatch) {
   if (lookup === undefined) {
     if (dns === undefined) {
       dns = require('dns');
@@ -40,20 +43,24 @@ function newHandle(type, lookup) {
     validateFunction(lookup, 'lookup');
   }
 
+  // Read several datagrams per system call when they are delivered in batches.
+  const flags = recvBatch === true ? UV_UDP_RECVMMSG : 0;
+
   if (type === 'udp4') {
-    const handle = new UDP();
+    const handle = new UDP(flags);
 
     handle.lookup = FunctionPrototypeBind(lookup4, handle, lookup);
     return handle;
   }
 
   if (type === 'udp6') {
-    const handle = new UDP();
+    const handle = new UDP(flags);
 
     handle.lookup = FunctionPrototypeBind(lookup6, handle, lookup);
     handle.bind = handle.bind6;
     handle.connect = handle.connect6;
     handle.send = handle.send6;
+    handle.sendBatch = handle.sendBatch6;
     return handle;
   }
 
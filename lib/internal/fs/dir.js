@@ -5,8 +5,10 @@ const {
   ArrayPrototypeSlice,
   ArrayPrototypeSplice,
   FunctionPrototypeBind,
+  NumberIsInteger,
   ObjectDefineProperty,
   PromiseReject,
+  PromiseResolve,
   Symbol,
   SymbolAsyncIterator,
 } = primordials;
@@ -14,24 +16,42 @@ const {
 const pathModule = require('path');
 const binding = internalBinding('fs');
 const dirBinding = internalBinding('fs_dir');
+const {
+  fs: {
+    UV_DIRENT_FILE,
+    UV_DIRENT_DIR,
+    UV_DIRENT_LINK,
+    UV_DIRENT_FIFO,
+    UV_DIRENT_SOCKET,
+    UV_DIRENT_CHAR,
+    UV_DIRENT_BLOCK
+  }
+} = internalBinding('constants');
 const {
   codes: {
     ERR_DIR_CLOSED,
     ERR_DIR_CONCURRENT_OPERATION,
-    ERR_MISSING_ARGS
+    ERR_INVALID_ARG_VALUE,
+    ERR_MISSING_ARGS,
+    ERR_OUT_OF_RANGE
   }
 } = require('internal/errors');
 
-const { FSReqCallback } = binding;
+const { FSReqCallback, kFsStatsFieldsNumber } = binding;
 const internalUtil = require('internal/util');
 const {
+  Dirent,
   getDirent,
   getOptions,
+  getStatsFromBinding,
   getValidatedPath,
   handleErrorFromBinding
 } = require('internal/fs/utils');
 const {
+  validateArray,
+  validateBoolean,
   validateCallback,
+  validateNumber,
   validateUint32
 } = require('internal/validators');
 
@@ -232,6 +252,189 @@ ObjectDefineProperty(Dir.prototype, SymbolAsyncIterator, {
   configurable: true,
 });
 
+const kWalkHandle = Symbol('kWalkHandle');
+const kWalkPath = Symbol('kWalkPath');
+const kWalkBatchSize = Symbol('kWalkBatchSize');
+const kWalkClosed = Symbol('kWalkClosed');
+const kWalkOperationQueue = Symbol('kWalkOperationQueue');
+const kWalkReadPromisified = Symbol('kWalkReadPromisified');
+
+const kWalkTypes = {
+  __proto__: null,
+  file: UV_DIRENT_FILE,
+  directory: UV_DIRENT_DIR,
+  symlink: UV_DIRENT_LINK,
+  fifo: UV_DIRENT_FIFO,
+  socket: UV_DIRENT_SOCKET,
+  characterDevice: UV_DIRENT_CHAR,
+  blockDevice: UV_DIRENT_BLOCK
+};
+
+class Walk {
+  constructor(handle, path, batchSize) {
+    if (handle == null) throw new ERR_MISSING_ARGS('handle');
+    this[kWalkHandle] = handle;
+    this[kWalkPath] = path;
+    this[kWalkBatchSize] = batchSize;
+    this[kWalkClosed] = false;
+
+    // Either `null` or an Array of pending reads (= functions to be called
+    // once the current read is done).
+    this[kWalkOperationQueue] = null;
+
+    this[kWalkReadPromisified] = FunctionPrototypeBind(
+      internalUtil.promisify(this.read), this);
+  }
+
+  get path() {
+    return this[kWalkPath];
+  }
+
+  read(callback) {
+    if (this[kWalkClosed] === true) {
+      throw new ERR_DIR_CLOSED();
+    }
+
+    if (callback === undefined) {
+      return this[kWalkReadPromisified]();
+    }
+
+    validateCallback(callback);
+
+    if (this[kWalkOperationQueue] !== null) {
+      ArrayPrototypePush(this[kWalkOperationQueue], () => {
+        if (this[kWalkClosed] === true)
+          callback(new ERR_DIR_CLOSED());
+        else
+          this.read(callback);
+      });
+      return;
+    }
+
+    const req = new FSReqCallback();
+    req.oncomplete = (err, result) => {
+      process.nextTick(() => {
+        const queue = this[kWalkOperationQueue];
+        this[kWalkOperationQueue] = null;
+        for (const op of queue) op();
+      });
+
+      if (err || result === null) {
+        return callback(err, null);
+      }
+
+      callback(null, getWalkDirents(result));
+    };
+
+    this[kWalkOperationQueue] = [];
+    this[kWalkHandle].read(this[kWalkBatchSize], req);
+  }
+
+  close(callback) {
+    if (callback !== undefined)
+      validateCallback(callback);
+
+    let err = null;
+    if (this[kWalkClosed] === true) {
+      err = new ERR_DIR_CLOSED();
+    } else {
+      // A pending read completes with `null`.
+      this[kWalkClosed] = true;
+      this[kWalkHandle].close();
+    }
+
+    if (callback === undefined)
+      return err === null ? PromiseResolve() : PromiseReject(err);
+    process.nextTick(callback, err);
+  }
+
+  async* entries() {
+    try {
+      while (true) {
+        const batch = await this[kWalkReadPromisified]();
+        if (batch === null) {
+          break;
+        }
+        yield* batch;
+      }
+    } finally {
+      if (this[kWalkClosed] === false)
+        await this.close();
+    }
+  }
+}
+
+ObjectDefineProperty(Walk.prototype, SymbolAsyncIterator, {
+  value: Walk.prototype.entries,
+  enumerable: false,
+  writable: true,
+  configurable: true,
+});
+
+function getWalkDirents({ 0: entries, 1: stats }) {
+  const dirents = [];
+  for (let i = 0; i < entries.length; i += 3) {
+    const dirent = new Dirent(entries[i], entries[i + 1]);
+    dirent.path = entries[i + 2];
+    if (stats !== undefined) {
+      dirent.stats =
+        getStatsFromBinding(stats, (i / 3) * kFsStatsFieldsNumber);
+    }
+    ArrayPrototypePush(dirents, dirent);
+  }
+  return dirents;
+}
+
+function walk(path, options) {
+  path = getValidatedPath(path);
+  options = getOptions(options, {
+    encoding: 'utf8'
+  });
+  const {
+    depth = Infinity,
+    followSymlinks = false,
+    types,
+    withStats = false,
+    bigint = false,
+    bufferSize = 1024
+  } = options;
+
+  validateNumber(depth, 'options.depth');
+  if (depth < 0 || (!NumberIsInteger(depth) && depth !== Infinity)) {
+    throw new ERR_OUT_OF_RANGE('options.depth',
+                               'a non-negative integer or Infinity', depth);
+  }
+  validateBoolean(followSymlinks, 'options.followSymlinks');
+  validateBoolean(withStats, 'options.withStats');
+  validateBoolean(bigint, 'options.bigint');
+  validateUint32(bufferSize, 'options.bufferSize', true);
+
+  // A bitmask of the UV_DIRENT_* types to report, 0 reports all of them.
+  let typeMask = 0;
+  if (types !== undefined) {
+    validateArray(types, 'options.types', { minLength: 1 });
+    for (let i = 0; i < types.length; i++) {
+      const type = typeof types[i] === 'string' ?
+        kWalkTypes[types[i]] : undefined;
+      if (type === undefined) {
+        throw new ERR_INVALID_ARG_VALUE(`options.types[${i}]`, types[i]);
+      }
+      typeMask |= 1 << type;
+    }
+  }
+
+  const handle = new dirBinding.WalkHandle(
+    pathModule.toNamespacedPath(path),
+    options.encoding,
+    depth,
+    followSymlinks,
+    typeMask,
+    withStats,
+    bigint
+  );
+  return new Walk(handle, path, bufferSize);
+}
+
 function opendir(path, options, callback) {
   callback = typeof options === 'function' ? options : callback;
   validateCallback(callback);
@@ -280,5 +483,7 @@ function opendirSync(path, options) {
 module.exports = {
   Dir,
   opendir,
-  opendirSync
+  opendirSync,
+  Walk,
+  walk
 };
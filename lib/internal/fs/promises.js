@@ -10,8 +10,12 @@ const kReadFileMaxChunkSize = 2 ** 14;
 const kWriteFileMaxChunkSize = 2 ** 14;
 
 const {
+  Array,
+  ArrayPrototypeMap,
   ArrayPrototypePush,
+  ArrayPrototypeShift,
   Error,
+  Float64Array,
   MathMax,
   MathMin,
   NumberIsSafeInteger,
@@ -32,30 +36,38 @@ const {
   S_IFREG
 } = internalBinding('constants').fs;
 const binding = internalBinding('fs');
-const { Buffer } = require('buffer');
+const { Buffer, kMaxLength } = require('buffer');
 
-const { codes, hideStackFrames } = require('internal/errors');
+const { codes, hideStackFrames, uvException } = require('internal/errors');
 const {
+  ERR_FEATURE_UNAVAILABLE_ON_PLATFORM,
   ERR_FS_FILE_TOO_LARGE,
   ERR_INVALID_ARG_TYPE,
   ERR_INVALID_ARG_VALUE,
+  ERR_INVALID_STATE,
   ERR_METHOD_NOT_IMPLEMENTED,
+  ERR_OUT_OF_RANGE,
 } = codes;
 const { isArrayBufferView } = require('internal/util/types');
+const { FastBuffer } = require('internal/buffer');
 const { rimrafPromises } = require('internal/fs/rimraf');
 const {
   copyObject,
   getDirents,
   getOptions,
   getStatsFromBinding,
+  getStatsManyFromBinding,
   getValidatedPath,
+  getValidatedPaths,
   getValidMode,
+  handleErrorFromBinding,
   nullCheck,
   preprocessSymlinkDestination,
   stringToFlags,
   stringToSymlinkType,
   toUnixTimestamp,
   validateBufferArray,
+  validateCpOptions,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validateRmOptions,
@@ -68,7 +80,10 @@ const {
   parseFileMode,
   validateBoolean,
   validateBuffer,
+  validateArray,
   validateInteger,
+  validateObject,
+  validateOneOf,
   validateUint32
 } = require('internal/validators');
 const pathModule = require('path');
@@ -83,6 +98,7 @@ const kCloseResolve = Symbol('kCloseResolve');
 const kCloseReject = Symbol('kCloseReject');
 const kRef = Symbol('kRef');
 const kUnref = Symbol('kUnref');
+const kReadingChunks = Symbol('kReadingChunks');
 
 const { kUsePromises } = binding;
 const {
@@ -107,6 +123,7 @@ class FileHandle extends EventEmitterMixin(JSTransferable) {
 
     this[kRefs] = 1;
     this[kClosePromise] = null;
+    this[kReadingChunks] = false;
   }
 
   getAsyncId() {
@@ -145,10 +162,22 @@ class FileHandle extends EventEmitterMixin(JSTransferable) {
     return fsCall(readv, this, buffers, position);
   }
 
+  readMany(requests) {
+    return fsCall(readMany, this, requests);
+  }
+
   readFile(options) {
     return fsCall(readFile, this, options);
   }
 
+  mmap(options) {
+    return fsCall(mmap, this, options);
+  }
+
+  readChunks(options) {
+    return readChunks(this, options);
+  }
+
   stat(options) {
     return fsCall(fstat, this, options);
   }
@@ -169,6 +198,10 @@ class FileHandle extends EventEmitterMixin(JSTransferable) {
     return fsCall(writev, this, buffers, position);
   }
 
+  writeMany(requests) {
+    return fsCall(writeMany, this, requests);
+  }
+
   writeFile(data, options) {
     return fsCall(writeFile, this, data, options);
   }
@@ -357,6 +390,19 @@ async function copyFile(src, dest, mode) {
                           kUsePromises);
 }
 
+async function cp(src, dest, options) {
+  src = getValidatedPath(src, 'src');
+  dest = getValidatedPath(dest, 'dest');
+  options = validateCpOptions(src, dest, options);
+  return binding.cpTree(pathModule.toNamespacedPath(src),
+                        pathModule.toNamespacedPath(dest),
+                        options.recursive,
+                        options.mode,
+                        options.force,
+                        options.errorOnExist,
+                        kUsePromises);
+}
+
 // Note that unlike fs.open() which uses numeric file descriptors,
 // fsPromises.open() uses the fs.FileHandle class.
 async function open(path, flags, mode) {
@@ -420,6 +466,49 @@ async function readv(handle, buffers, position) {
   return { bytesRead, buffers };
 }
 
+// Splits an array of { buffer, offset, length, position } requests into the
+// array of buffers and the packed (offset, length, position) ranges that
+// binding.readMany() and binding.writeMany() expect.
+function getManyRanges(requests) {
+  validateArray(requests, 'requests');
+  const buffers = new Array(requests.length);
+  const ranges = new Float64Array(requests.length * 3);
+  for (let i = 0; i < requests.length; i++) {
+    const request = requests[i];
+    validateObject(request, `requests[${i}]`);
+    const { buffer, offset = 0, position } = request;
+    if (!isArrayBufferView(buffer)) {
+      throw new ERR_INVALID_ARG_TYPE(`requests[${i}].buffer`,
+                                     ['Buffer', 'TypedArray', 'DataView'],
+                                     buffer);
+    }
+    validateInteger(offset, `requests[${i}].offset`, 0, buffer.byteLength);
+    const { length = buffer.byteLength - offset } = request;
+    validateInteger(length, `requests[${i}].length`, 0,
+                    MathMin(buffer.byteLength - offset, kIoMaxLength));
+    validateInteger(position, `requests[${i}].position`, 0);
+    buffers[i] = buffer;
+    ranges[i * 3] = offset;
+    ranges[i * 3 + 1] = length;
+    ranges[i * 3 + 2] = position;
+  }
+  return { buffers, ranges };
+}
+
+async function readMany(handle, requests) {
+  const { buffers, ranges } = getManyRanges(requests);
+  const bytesRead = await binding.readMany(handle.fd, buffers, ranges,
+                                           kUsePromises);
+  return { bytesRead, requests };
+}
+
+async function writeMany(handle, requests) {
+  const { buffers, ranges } = getManyRanges(requests);
+  const bytesWritten = await binding.writeMany(handle.fd, buffers, ranges,
+                                               kUsePromises);
+  return { bytesWritten, requests };
+}
+
 async function write(handle, buffer, offset, length, position) {
   if (buffer.length === 0)
     return { bytesWritten: 0, buffer };
@@ -552,6 +641,134 @@ async function fstat(handle, options = { bigint: false }) {
   return getStatsFromBinding(result);
 }
 
+const kMmapAdvice = ['normal', 'random', 'sequential', 'willneed', 'dontneed'];
+
+async function mmap(handle, options = {}) {
+  validateObject(options, 'options');
+  const {
+    offset = 0,
+    mode = 'private',
+    advice = 'normal'
+  } = options;
+  let { length } = options;
+  validateInteger(offset, 'options.offset', 0);
+  validateOneOf(mode, 'options.mode', ['private', 'shared']);
+  validateOneOf(advice, 'options.advice', kMmapAdvice);
+  if (process.platform === 'win32')
+    throw new ERR_FEATURE_UNAVAILABLE_ON_PLATFORM('filehandle.mmap()');
+
+  // Touching pages of the mapping that are past the end of the file raises
+  // SIGBUS, so the mapping must fit into the file.
+  const { size } = await fstat(handle);
+  if (length === undefined)
+    length = size - offset;
+  validateInteger(length, 'options.length', 1, kMaxLength);
+  if (offset + length > size) {
+    throw new ERR_OUT_OF_RANGE('options.offset + options.length',
+                               `<= ${size}`, offset + length);
+  }
+
+  const ctx = {};
+  const arrayBuffer =
+    handle[kHandle].mmap(offset, length, mode === 'shared', advice, ctx);
+  handleErrorFromBinding(ctx);
+  return arrayBuffer;
+}
+
+function readChunks(filehandle, options) {
+  validateObject(options, 'options');
+  const {
+    buffers,
+    position = 0,
+    length
+  } = options;
+  let { readAhead } = options;
+  validateArray(buffers, 'options.buffers', { minLength: 1 });
+  for (let i = 0; i < buffers.length; i++) {
+    if (!isArrayBufferView(buffers[i])) {
+      throw new ERR_INVALID_ARG_TYPE(`options.buffers[${i}]`,
+                                     ['Buffer', 'TypedArray', 'DataView'],
+                                     buffers[i]);
+    }
+    if (buffers[i].byteLength === 0) {
+      throw new ERR_INVALID_ARG_VALUE(`options.buffers[${i}]`, buffers[i],
+                                      'must not be empty');
+    }
+  }
+  if (readAhead === undefined)
+    readAhead = MathMin(2, buffers.length);
+  validateInteger(readAhead, 'options.readAhead', 1, buffers.length);
+  validateInteger(position, 'options.position', 0);
+  if (length !== undefined)
+    validateInteger(length, 'options.length', 0);
+
+  return readChunksImpl(filehandle, buffers, readAhead, position,
+                        length ?? -1);
+}
+
+async function* readChunksImpl(filehandle, buffers, readAhead, position,
+                               length) {
+  if (filehandle.fd === -1) {
+    // eslint-disable-next-line no-restricted-syntax
+    const err = new Error('file closed');
+    err.code = 'EBADF';
+    err.syscall = 'read';
+    throw err;
+  }
+  if (length === 0)
+    return;
+  // The pooled buffers belong to a single read at a time.
+  if (filehandle[kReadingChunks])
+    throw new ERR_INVALID_STATE('readChunks() is already in progress');
+
+  const handle = filehandle[kHandle];
+  // Pairs of [index, nread], in file order. The index is -1 once reading has
+  // ended, and nread is then either UV_EOF or an error.
+  const chunks = [];
+  let wake = null;
+  filehandle[kReadingChunks] = true;
+  filehandle[kRef]();
+  try {
+    const err = handle.readPooled(buffers, readAhead, position, length,
+                                  (index, nread) => {
+                                    ArrayPrototypePush(chunks, index, nread);
+                                    if (wake !== null) {
+                                      const resolve = wake;
+                                      wake = null;
+                                      resolve();
+                                    }
+                                  });
+    if (err !== 0)
+      throw uvException({ errno: err, syscall: 'read' });
+
+    while (true) {
+      if (chunks.length === 0)
+        await new Promise((resolve) => { wake = resolve; });
+      const index = ArrayPrototypeShift(chunks);
+      const nread = ArrayPrototypeShift(chunks);
+      if (index === -1) {
+        // The uv binding is not loaded during bootstrap.
+        if (nread === internalBinding('uv').UV_EOF)
+          return;
+        throw uvException({ errno: nread, syscall: 'read' });
+      }
+      const buffer = buffers[index];
+      yield new FastBuffer(buffer.buffer, buffer.byteOffset, nread);
+      // The consumer is done with the chunk, so the buffer can be reused.
+      handle.releasePooledBuffer(index);
+    }
+  } finally {
+    // Reads that are still in flight write into `buffers` and use the file
+    // descriptor, so wait for them before handing both back.
+    await new Promise((resolve) => {
+      if (!handle.stopPooledRead(resolve))
+        resolve();
+    });
+    filehandle[kReadingChunks] = false;
+    filehandle[kUnref]();
+  }
+}
+
 async function lstat(path, options = { bigint: false }) {
   path = getValidatedPath(path);
   const result = await binding.lstat(pathModule.toNamespacedPath(path),
@@ -559,6 +776,22 @@ async function lstat(path, options = { bigint: false }) {
   return getStatsFromBinding(result);
 }
 
+async function lstatMany(paths, options = { bigint: false }) {
+  paths = getValidatedPaths(paths);
+  const result = await binding.statMany(
+    ArrayPrototypeMap(paths, pathModule.toNamespacedPath),
+    true, options.bigint, kUsePromises);
+  return getStatsManyFromBinding(result, paths, 'lstat');
+}
+
+async function statMany(paths, options = { bigint: false }) {
+  paths = getValidatedPaths(paths);
+  const result = await binding.statMany(
+    ArrayPrototypeMap(paths, pathModule.toNamespacedPath),
+    false, options.bigint, kUsePromises);
+  return getStatsManyFromBinding(result, paths, 'stat');
+}
+
 async function stat(path, options = { bigint: false }) {
   path = getValidatedPath(path);
   const result = await binding.stat(pathModule.toNamespacedPath(path),
@@ -691,6 +924,23 @@ async function readFile(path, options) {
   if (path instanceof FileHandle)
     return readFileHandle(path, options);
 
+  if (!options.signal) {
+    // Without a signal to check between reads, the file is opened, read and
+    // closed with a single request.
+    const { encoding } = options;
+    path = getValidatedPath(path);
+    const data = await binding.readFile(pathModule.toNamespacedPath(path),
+                                        stringToFlags(flag),
+                                        encoding === 'utf8' ||
+                                          encoding === 'utf-8',
+                                        kUsePromises);
+    if (typeof data === 'number')
+      throw new ERR_FS_FILE_TOO_LARGE(data);
+    if (encoding && typeof data !== 'string')
+      return data.toString(encoding);
+    return data;
+  }
+
   const fd = await open(path, flag, 0o666);
   return PromisePrototypeFinally(readFileHandle(fd, options), fd.close);
 }
@@ -699,6 +949,7 @@ module.exports = {
   exports: {
     access,
     copyFile,
+    cp,
     open,
     opendir: promisify(opendir),
     rename,
@@ -710,7 +961,9 @@ module.exports = {
     readlink,
     symlink,
     lstat,
+    lstatMany,
     stat,
+    statMany,
     link,
     unlink,
     chmod,
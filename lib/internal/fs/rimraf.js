@@ -14,6 +14,9 @@ const {
 
 const { Buffer } = require('buffer');
 const fs = require('fs');
+const binding = internalBinding('fs');
+const { FSReqCallback } = binding;
+const { handleErrorFromBinding } = require('internal/fs/utils');
 const {
   chmod,
   chmodSync,
@@ -41,7 +44,21 @@ const readdirEncoding = 'buffer';
 const separator = Buffer.from(sep);
 
 
+// The whole tree is removed by a single native request first, which only
+// calls back into JS once. Errors that may be transient, or that are caused by
+// read-only entries on Windows, are handled by removing what is left in JS.
 function rimraf(path, options, callback) {
+  const req = new FSReqCallback();
+  req.oncomplete = (err) => {
+    if (err && retryErrorCodes.has(err.code))
+      return rimrafJS(path, options, callback);
+    callback(err ?? null);
+  };
+  binding.rmTree(path, req);
+}
+
+
+function rimrafJS(path, options, callback) {
   let retries = 0;
 
   _rimraf(path, options, function CB(err) {
@@ -174,6 +191,19 @@ function rimrafPromises(path, options) {
 
 
 function rimrafSync(path, options) {
+  const ctx = {};
+  binding.rmTree(path, undefined, ctx);
+  try {
+    handleErrorFromBinding(ctx);
+  } catch (err) {
+    if (!retryErrorCodes.has(err.code))
+      throw err;
+    rimrafSyncJS(path, options);
+  }
+}
+
+
+function rimrafSyncJS(path, options) {
   let stats;
 
   try {
@@ -2,6 +2,7 @@
 
 const {
   ArrayIsArray,
+  ArrayPrototypePush,
   BigInt,
   Date,
   DateNow,
@@ -17,9 +18,11 @@ const {
   ObjectSetPrototypeOf,
   ReflectApply,
   ReflectOwnKeys,
+  String,
   StringPrototypeEndsWith,
   StringPrototypeIncludes,
   StringPrototypeReplace,
+  StringPrototypeStartsWith,
   Symbol,
   TypedArrayPrototypeIncludes,
 } = primordials;
@@ -99,6 +102,7 @@ const {
     }
   }
 } = internalBinding('constants');
+const { kFsStatsFieldsNumber } = internalBinding('fs');
 
 // The access modes can be any of F_OK, R_OK, W_OK or X_OK. Some might not be
 // available on specific systems. They can be used in combination as well
@@ -526,6 +530,24 @@ function getStatsFromBinding(stats, offset = 0) {
   );
 }
 
+// Convert the result of binding.statMany() into an array of Stats objects,
+// with an error in place of each path that could not be stat'ed.
+function getStatsManyFromBinding(result, paths, syscall) {
+  const { 0: stats, 1: errors } = result;
+  const statsMany = [];
+  for (let i = 0; i < errors.length; i++) {
+    if (errors[i] === 0) {
+      ArrayPrototypePush(statsMany,
+                         getStatsFromBinding(stats, i * kFsStatsFieldsNumber));
+    } else {
+      ArrayPrototypePush(statsMany,
+                         uvException({ errno: errors[i], syscall,
+                                       path: paths[i] }));
+    }
+  }
+  return statsMany;
+}
+
 function stringToFlags(flags) {
   if (typeof flags === 'number') {
     return flags;
@@ -650,6 +672,16 @@ const getValidatedPath = hideStackFrames((fileURLOrPath, propName = 'path') => {
   return path;
 });
 
+const getValidatedPaths = hideStackFrames((paths, propName = 'paths') => {
+  if (!ArrayIsArray(paths))
+    throw new ERR_INVALID_ARG_TYPE(propName, 'Array', paths);
+  const validated = [];
+  for (let i = 0; i < paths.length; i++)
+    ArrayPrototypePush(validated,
+                       getValidatedPath(paths[i], `${propName}[${i}]`));
+  return validated;
+});
+
 const getValidatedFd = hideStackFrames((fd, propName = 'fd') => {
   if (ObjectIs(fd, -0)) {
     return 0;
@@ -755,6 +787,35 @@ const validateRmOptionsSync = hideStackFrames((path, options, warn) => {
   return options;
 });
 
+const defaultCpOptions = {
+  recursive: false,
+  force: true,
+  errorOnExist: false,
+  mode: 0
+};
+
+const validateCpOptions = hideStackFrames((src, dest, options) => {
+  if (options === undefined)
+    return { ...defaultCpOptions };
+  validateObject(options, 'options');
+  options = { ...defaultCpOptions, ...options };
+  validateBoolean(options.recursive, 'options.recursive');
+  validateBoolean(options.force, 'options.force');
+  validateBoolean(options.errorOnExist, 'options.errorOnExist');
+  options.mode = getValidMode(options.mode, 'copyFile');
+
+  // A directory that is copied into itself would never be finished.
+  const resolvedSrc = pathModule.resolve(String(src));
+  const resolvedDest = pathModule.resolve(String(dest));
+  if (resolvedDest === resolvedSrc ||
+      StringPrototypeStartsWith(resolvedDest,
+                                `${resolvedSrc}${pathModule.sep}`)) {
+    throw new ERR_INVALID_ARG_VALUE('dest', dest,
+                                    'must not be src or inside of src');
+  }
+  return options;
+});
+
 let permissiveRmdirWarned = false;
 
 function emitPermissiveRmdirWarning() {
@@ -856,17 +917,20 @@ module.exports = {
   getOptions,
   getValidatedFd,
   getValidatedPath,
+  getValidatedPaths,
   getValidMode,
   handleErrorFromBinding,
   nullCheck,
   preprocessSymlinkDestination,
   realpathCacheKey: Symbol('realpathCacheKey'),
   getStatsFromBinding,
+  getStatsManyFromBinding,
   stringToFlags,
   stringToSymlinkType,
   Stats,
   toUnixTimestamp,
   validateBufferArray,
+  validateCpOptions,
   validateOffsetLengthRead,
   validateOffsetLengthWrite,
   validatePath,
@@ -9,6 +9,12 @@ const {
 const Buffer = require('buffer').Buffer;
 const { writeBuffer } = internalBinding('fs');
 const errors = require('internal/errors');
+const {
+  validateInt32,
+  validateInteger
+} = require('internal/validators');
+
+const kSendFile = Symbol('kSendFile');
 
 // IPv4 Segment
 const v4Seg = '(?:[0-9]|[1-9][0-9]|1[0-9][0-9]|2[0-4][0-9]|25[0-5])';
@@ -60,10 +66,58 @@ function makeSyncWrite(fd) {
   };
 }
 
+// Returns an empty Buffer that stands in for a range of `file` when it is
+// written to a net.Socket. The file is queued like any other write and then
+// sent without being read into JS. `done()` must be called once the write has
+// completed, to release the file.
+function createSendFileChunk(file, options) {
+  let fd;
+  let done = nop;
+  if (typeof file === 'number') {
+    validateInt32(file, 'file', 0);
+    fd = file;
+  } else {
+    const { FileHandle, kRef, kUnref } = require('internal/fs/promises');
+    if (!(file instanceof FileHandle)) {
+      throw new errors.codes.ERR_INVALID_ARG_TYPE(
+        'file', ['number', 'FileHandle'], file);
+    }
+    fd = file.fd;
+    if (fd === -1) {
+      throw new errors.codes.ERR_INVALID_ARG_VALUE(
+        'file', file, 'is closed');
+    }
+    // Keep the file open until it has been sent.
+    file[kRef]();
+    done = () => file[kUnref]();
+  }
+
+  let offset = 0;
+  let length = -1;
+  if (options != null) {
+    if (options.offset !== undefined) {
+      validateInteger(options.offset, 'options.offset', 0);
+      offset = options.offset;
+    }
+    if (options.length !== undefined) {
+      validateInteger(options.length, 'options.length', 0);
+      length = options.length;
+    }
+  }
+
+  const chunk = Buffer.alloc(0);
+  chunk[kSendFile] = { fd, offset, length };
+  return { chunk, fd, offset, length, done };
+}
+
+function nop() {}
+
 module.exports = {
+  createSendFileChunk,
   isIP,
   isIPv4,
   isIPv6,
+  kSendFile,
   makeSyncWrite,
   normalizedArgsSymbol: Symbol('normalizedArgs')
 };
@@ -96,7 +96,8 @@ function wrapProcessMethods(binding) {
     cpuUsage: _cpuUsage,
     memoryUsage: _memoryUsage,
     rss,
-    resourceUsage: _resourceUsage
+    resourceUsage: _resourceUsage,
+    threadpoolUsage: _threadpoolUsage
   } = binding;
 
   function _rawDebug(...args) {
@@ -237,11 +238,31 @@ function wrapProcessMethods(binding) {
     };
   }
 
+  // The pools in the order in which the binding reports them.
+  const threadpoolNames = ['io', 'cpu', 'dns'];
+  const threadpoolValues = new Float64Array(6 * threadpoolNames.length);
+  function threadpoolUsage() {
+    _threadpoolUsage(threadpoolValues);
+    const usage = {};
+    for (let i = 0; i < threadpoolNames.length; i++) {
+      const offset = i * 6;
+      usage[threadpoolNames[i]] = {
+        size: threadpoolValues[offset],
+        queued: threadpoolValues[offset + 1],
+        maxQueued: threadpoolValues[offset + 2],
+        completed: threadpoolValues[offset + 3],
+        waitTime: threadpoolValues[offset + 4],
+        maxWaitTime: threadpoolValues[offset + 5]
+      };
+    }
+    return usage;
+  }
 
   return {
     _rawDebug,
     cpuUsage,
     resourceUsage,
+    threadpoolUsage,
     memoryUsage,
     kill,
     exit
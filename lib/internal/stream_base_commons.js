@@ -152,6 +152,16 @@ function writeGeneric(self, data, encoding, cb) {
   return req;
 }
 
+// Sends `length` bytes of the file `fd`, starting at `offset`, without
+// copying them through JS. A negative `length` sends the rest of the file.
+function sendFileGeneric(self, fd, offset, length, cb) {
+  const req = createWriteWrap(self[kHandle], cb);
+  const err = req.handle.sendFile(req, fd, offset, length);
+
+  afterWriteDispatched(req, err, cb);
+  return req;
+}
+
 function afterWriteDispatched(req, err, cb) {
   req.bytes = streamBaseState[kBytesWritten];
   req.async = !!streamBaseState[kLastWriteWasAsync];
@@ -275,6 +285,7 @@ function setStreamTimeout(msecs, callback) {
 module.exports = {
   writevGeneric,
   writeGeneric,
+  sendFileGeneric,
   onStreamRead,
   kAfterAsyncWrite,
   kMaybeDestroy,
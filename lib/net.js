@@ -25,11 +25,13 @@ const {
   ArrayIsArray,
   ArrayPrototypeIndexOf,
   ArrayPrototypePush,
+  ArrayPrototypeSlice,
   ArrayPrototypeSplice,
   Boolean,
   Error,
   FunctionPrototype,
   FunctionPrototypeCall,
+  MathMin,
   Number,
   NumberIsNaN,
   NumberParseInt,
@@ -45,9 +47,11 @@ let debug = require('internal/util/debuglog').debuglog('net', (fn) => {
   debug = fn;
 });
 const {
+  createSendFileChunk,
   isIP,
   isIPv4,
   isIPv6,
+  kSendFile,
   normalizedArgsSymbol,
   makeSyncWrite
 } = require('internal/net');
@@ -55,7 +59,8 @@ const assert = require('internal/assert');
 const {
   UV_EADDRINUSE,
   UV_EINVAL,
-  UV_ENOTCONN
+  UV_ENOTCONN,
+  UV_EOF
 } = internalBinding('uv');
 
 const { Buffer } = require('buffer');
@@ -71,6 +76,7 @@ const {
   PipeConnectWrap,
   constants: PipeConstants
 } = internalBinding('pipe_wrap');
+const { StreamPipe } = internalBinding('stream_pipe');
 const {
   newAsyncId,
   defaultTriggerAsyncIdScope,
@@ -79,6 +85,7 @@ const {
 const {
   writevGeneric,
   writeGeneric,
+  sendFileGeneric,
   onStreamRead,
   kAfterAsyncWrite,
   kHandle,
@@ -107,6 +114,8 @@ const {
 const { isUint8Array } = require('internal/util/types');
 const {
   validateAbortSignal,
+  validateBoolean,
+  validateFunction,
   validateInt32,
   validateNumber,
   validatePort,
@@ -264,6 +273,13 @@ function initSocketHandle(self) {
         self[kBuffer] = userBuf;
       }
       self._handle.useUserBuffer(userBuf);
+    } else if (self[kPooledReads]) {
+      self._handle.usePooledReadBuffer();
+    }
+
+    if (self[kCoalesceWrites] &&
+        typeof self._handle.setCoalesceWrites === 'function') {
+      self._handle.setCoalesceWrites(true);
     }
   }
 }
@@ -272,6 +288,9 @@ function initSocketHandle(self) {
 const kBytesRead = Symbol('kBytesRead');
 const kBytesWritten = Symbol('kBytesWritten');
 const kSetNoDelay = Symbol('kSetNoDelay');
+const kPooledReads = Symbol('kPooledReads');
+const kCoalesceWrites = Symbol('kCoalesceWrites');
+const kAcceptBatchSize = Symbol('kAcceptBatchSize');
 
 function Socket(options) {
   if (!(this instanceof Socket)) return new Socket(options);
@@ -291,6 +310,8 @@ function Socket(options) {
   this[kBuffer] = null;
   this[kBufferCb] = null;
   this[kBufferGen] = null;
+  this[kPooledReads] = false;
+  this[kCoalesceWrites] = false;
 
   if (typeof options === 'number')
     options = { fd: options }; // Legacy interface.
@@ -358,6 +379,14 @@ function Socket(options) {
     }
     this[kBufferCb] = onread.callback;
   }
+  if (options.pooledReads !== undefined) {
+    validateBoolean(options.pooledReads, 'options.pooledReads');
+    this[kPooledReads] = options.pooledReads;
+  }
+  if (options.coalesceWrites !== undefined) {
+    validateBoolean(options.coalesceWrites, 'options.coalesceWrites');
+    this[kCoalesceWrites] = options.coalesceWrites;
+  }
 
   // Shut down the socket when we're finished with it.
   this.on('end', onReadableStreamEnd);
@@ -773,16 +802,71 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
   this._unrefTimer();
 
   let req;
-  if (writev)
+  if (writev) {
     req = writevGeneric(this, data, cb);
-  else
+  } else if (data[kSendFile] !== undefined) {
+    const { fd, offset, length } = data[kSendFile];
+    if (isWindows || typeof this._handle.sendFile !== 'function') {
+      sendFileSlow(this, fd, offset, length, cb);
+      return;
+    }
+    req = sendFileGeneric(this, fd, offset, length, cb);
+  } else {
     req = writeGeneric(this, data, encoding, cb);
+  }
   if (req.async)
     this[kLastWriteQueueSize] = req.bytes;
 };
 
 
+// Reads the file into a Buffer and writes it chunk by chunk. This is used for
+// streams that can't send files natively, such as TLS sockets.
+function sendFileSlow(socket, fd, offset, length, cb) {
+  const fs = require('fs');
+  const buffer = Buffer.allocUnsafe(64 * 1024);
+
+  function readChunk() {
+    const toRead = length < 0 ? buffer.length : MathMin(buffer.length, length);
+    if (toRead === 0)
+      return cb();
+    fs.read(fd, buffer, 0, toRead, offset, (err, bytesRead) => {
+      if (err)
+        return cb(err);
+      if (bytesRead === 0)
+        return cb(length < 0 ? null : errnoException(UV_EOF, 'read'));
+      offset += bytesRead;
+      if (length > 0)
+        length -= bytesRead;
+      socket._writeGeneric(false, buffer.slice(0, bytesRead), 'buffer',
+                           (err) => (err ? cb(err) : readChunk()));
+    });
+  }
+  readChunk();
+}
+
+
 Socket.prototype._writev = function(chunks, cb) {
+  for (let i = 0; i < chunks.length; i++) {
+    if (chunks[i].chunk[kSendFile] === undefined)
+      continue;
+    // Files can't be part of a writev() call. Write the chunks before the
+    // file, then the file, then the rest.
+    const sendFile = () => {
+      this._writeGeneric(false, chunks[i].chunk, 'buffer', (err) => {
+        if (err || i === chunks.length - 1)
+          cb(err);
+        else
+          this._writev(ArrayPrototypeSlice(chunks, i + 1), cb);
+      });
+    };
+    if (i === 0) {
+      sendFile();
+    } else {
+      this._writeGeneric(true, ArrayPrototypeSlice(chunks, 0, i), '',
+                         (err) => (err ? cb(err) : sendFile()));
+    }
+    return;
+  }
   this._writeGeneric(true, chunks, '', cb);
 };
 
@@ -1074,6 +1158,111 @@ function connectErrorNT(self, err) {
 }
 
 
+// Send a range of a file without reading it into JS. The file is queued like
+// any other write, so it is sent in order with the data around it.
+Socket.prototype.sendFile = function(file, options, callback) {
+  if (typeof options === 'function') {
+    callback = options;
+    options = undefined;
+  }
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+  const { chunk, done } = createSendFileChunk(file, options);
+
+  return this.write(chunk, (err) => {
+    done();
+    if (callback)
+      callback(err);
+  });
+};
+
+
+// Move all data that is read from this socket into `destination` without
+// passing it through JS. When both ends are TCP sockets or pipes, this uses
+// splice(2) where supported.
+Socket.prototype.forward = function(destination, callback) {
+  if (!(destination instanceof Socket)) {
+    throw new ERR_INVALID_ARG_TYPE('destination', 'net.Socket', destination);
+  }
+  if (callback !== undefined)
+    validateFunction(callback, 'callback');
+
+  if (this.connecting || destination.connecting) {
+    const socket = this.connecting ? this : destination;
+    socket.once('connect', () => this.forward(destination, callback));
+    return this;
+  }
+  if (!this._handle || !destination._handle)
+    throw new ERR_SOCKET_CLOSED();
+
+  debug('forward');
+  this.pause();
+
+  // Data that has already been read has to be written first.
+  const chunks = [];
+  let chunk;
+  while ((chunk = this.read()) !== null)
+    chunks.push(typeof chunk === 'string' ? Buffer.from(chunk) : chunk);
+
+  if (chunks.length > 0 || destination.writableLength > 0) {
+    destination.write(Buffer.concat(chunks), (err) => {
+      if (err) {
+        if (callback) callback(err);
+      } else {
+        startForward(this, destination, callback);
+      }
+    });
+  } else {
+    startForward(this, destination, callback);
+  }
+  return this;
+};
+
+function startForward(source, destination, callback) {
+  if (!source._handle || !destination._handle) {
+    if (callback) callback(new ERR_SOCKET_CLOSED());
+    return;
+  }
+
+  const pipe = new StreamPipe(source._handle, destination._handle);
+  let error = null;
+  const unpipe = () => pipe.unpipe();
+  pipe.onerror = (err) => {
+    error = errnoException(err, 'write');
+  };
+  pipe.onunpipe = () => {
+    source.removeListener('close', unpipe);
+    destination.removeListener('close', unpipe);
+    if (error) {
+      source.destroy();
+      destination.destroy();
+    } else if (!destination.destroyed) {
+      // The pipe has already shut down the writable side of the handle once
+      // the source ended, so this only finishes the JS stream.
+      destination.end();
+    }
+    // Let the source emit 'end' if it reached EOF.
+    if (source.readableEnded === false && source._readableState.ended)
+      source.resume();
+    if (callback) callback(error);
+  };
+  source.once('close', unpipe);
+  destination.once('close', unpipe);
+  source._handle.reading = false;
+  pipe.start(true);
+}
+
+
+Socket.prototype.getCoalescedWriteStats = function() {
+  if (!this._handle ||
+      typeof this._handle.getCoalescedWriteStats !== 'function') {
+    return { writes: 0, flushes: 0 };
+  }
+  const stats = this._handle.getCoalescedWriteStats();
+  return { writes: stats[0], flushes: stats[1] };
+};
+
+
 Socket.prototype.ref = function() {
   if (!this._handle) {
     this.once('connect', this.ref);
@@ -1200,6 +1389,13 @@ function Server(options, connectionListener) {
 
   this.allowHalfOpen = options.allowHalfOpen || false;
   this.pauseOnConnect = !!options.pauseOnConnect;
+  this[kAcceptBatchSize] = 0;
+  if (options.pooledReads !== undefined)
+    validateBoolean(options.pooledReads, 'options.pooledReads');
+  this[kPooledReads] = !!options.pooledReads;
+  if (options.coalesceWrites !== undefined)
+    validateBoolean(options.coalesceWrites, 'options.coalesceWrites');
+  this[kCoalesceWrites] = !!options.coalesceWrites;
 }
 ObjectSetPrototypeOf(Server.prototype, EventEmitter.prototype);
 ObjectSetPrototypeOf(Server, EventEmitter);
@@ -1249,12 +1445,13 @@ function createServerHandle(address, port, addressType, fd, flags) {
       if (err) {
         handle.close();
         // Fallback to ipv4
-        return createServerHandle(DEFAULT_IPV4_ADDR, port);
+        return createServerHandle(DEFAULT_IPV4_ADDR, port, 4, undefined,
+                                  flags);
       }
     } else if (addressType === 6) {
       err = handle.bind6(address, port, flags);
     } else {
-      err = handle.bind(address, port);
+      err = handle.bind(address, port, flags);
     }
   }
 
@@ -1307,6 +1504,13 @@ function setupListenHandle(address, port, addressType, backlog, fd, flags) {
   this._handle.onconnection = onconnection;
   this._handle[owner_symbol] = this;
 
+  // Handles that are managed by the cluster primary (round-robin mode) do not
+  // accept connections themselves.
+  if (this[kAcceptBatchSize] > 0 &&
+      typeof this._handle.setAcceptBatchSize === 'function') {
+    this._handle.setAcceptBatchSize(this[kAcceptBatchSize]);
+  }
+
   // Use a backlog of 512 entries. We pass 511 to the listen() call because
   // the kernel does: backlogsize = roundup_pow_of_two(backlogsize + 1);
   // which will thus give us a backlog of 512 entries.
@@ -1357,7 +1561,8 @@ function listenInCluster(server, address, port, addressType,
 
   if (cluster === undefined) cluster = require('cluster');
 
-  if (cluster.isPrimary || exclusive) {
+  // Sockets with SO_REUSEPORT set can be bound by every worker on its own.
+  if (cluster.isPrimary || exclusive || (flags & TCPConstants.REUSEPORT)) {
     // Will create a new handle
     // _listen2 sets up the listened handle, it is still named like this
     // to avoid breaking code that wraps this method
@@ -1411,7 +1616,12 @@ Server.prototype.listen = function(...args) {
     toNumber(args.length > 2 && args[2]);  // (port, host, backlog)
 
   options = options._handle || options.handle || options;
-  const flags = getFlags(options.ipv6Only);
+  let flags = getFlags(options.ipv6Only);
+  if (options.reusePort !== undefined) {
+    validateBoolean(options.reusePort, 'options.reusePort');
+    if (options.reusePort)
+      flags |= TCPConstants.REUSEPORT;
+  }
   // (handle[, backlog][, cb]) where handle is an object with a handle
   if (options instanceof TCP) {
     this._handle = options;
@@ -1420,6 +1630,10 @@ Server.prototype.listen = function(...args) {
     return this;
   }
   addAbortSignalOption(this, options);
+  if (options.acceptBatchSize !== undefined) {
+    validateInt32(options.acceptBatchSize, 'options.acceptBatchSize', 1);
+    this[kAcceptBatchSize] = options.acceptBatchSize;
+  }
   // (handle[, backlog][, cb]) where handle is an object with a fd
   if (typeof options.fd === 'number' && options.fd >= 0) {
     listenInCluster(this, null, null, null, backlogFromArgs, options.fd);
@@ -1449,7 +1663,7 @@ Server.prototype.listen = function(...args) {
     } else { // Undefined host, listens on unspecified address
       // Default addressType 4 will be used to search for primary server
       listenInCluster(this, null, options.port | 0, 4,
-                      backlog, undefined, options.exclusive);
+                      backlog, undefined, options.exclusive, flags);
     }
     return this;
   }
@@ -1538,6 +1752,17 @@ function onconnection(err, clientHandle) {
     return;
   }
 
+  // With `acceptBatchSize`, several handles are passed in at once.
+  if (ArrayIsArray(clientHandle)) {
+    for (let i = 0; i < clientHandle.length; i++)
+      acceptConnection(self, clientHandle[i]);
+    return;
+  }
+
+  acceptConnection(self, clientHandle);
+}
+
+function acceptConnection(self, clientHandle) {
   if (self.maxConnections && self._connections >= self.maxConnections) {
     clientHandle.close();
     return;
@@ -1547,6 +1772,8 @@ function onconnection(err, clientHandle) {
     handle: clientHandle,
     allowHalfOpen: self.allowHalfOpen,
     pauseOnCreate: self.pauseOnConnect,
+    pooledReads: self[kPooledReads],
+    coalesceWrites: self[kCoalesceWrites],
     readable: true,
     writable: true
   });
@@ -20,6 +20,8 @@ const {
 
 const {
   ELDHistogram: _ELDHistogram,
+  ThreadpoolMonitor: _ThreadpoolMonitor,
+  threadpoolWorkTypes,
   PerformanceEntry,
   mark: _mark,
   clearMark: _clearMark,
@@ -635,6 +637,46 @@ class ELDHistogram extends Histogram {
   disable() { return this[kHandle].disable(); }
 }
 
+// Must match ThreadpoolMonitor::HistogramField in src/node_perf.h.
+const kQueueTime = 0;
+const kRunTime = 1;
+const kQueueDepth = 2;
+
+class ThreadpoolMonitor {
+  constructor(handle) {
+    this[kHandle] = handle;
+    ArrayPrototypeForEach(threadpoolWorkTypes, (name, type) => {
+      const stats = ObjectDefineProperties({}, {
+        count: {
+          enumerable: true,
+          get() { return handle.count(type); }
+        },
+        queueTime: {
+          enumerable: true,
+          value: new Histogram(handle.histogram(type, kQueueTime))
+        },
+        runTime: {
+          enumerable: true,
+          value: new Histogram(handle.histogram(type, kRunTime))
+        },
+        queueDepth: {
+          enumerable: true,
+          value: new Histogram(handle.histogram(type, kQueueDepth))
+        },
+      });
+      ObjectDefineProperty(this, name, { enumerable: true, value: stats });
+    });
+  }
+
+  enable() { return this[kHandle].enable(); }
+  disable() { return this[kHandle].disable(); }
+  reset() { this[kHandle].reset(); }
+}
+
+function monitorThreadpool() {
+  return new ThreadpoolMonitor(new _ThreadpoolMonitor());
+}
+
 function monitorEventLoopDelay(options = {}) {
   validateObject(options, 'options');
   const { resolution = 10 } = options;
@@ -651,7 +693,8 @@ function monitorEventLoopDelay(options = {}) {
 module.exports = {
   performance,
   PerformanceObserver,
-  monitorEventLoopDelay
+  monitorEventLoopDelay,
+  monitorThreadpool,
 };
 
 ObjectDefineProperty(module.exports, 'constants', {
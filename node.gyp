@@ -116,6 +116,7 @@
       'lib/internal/child_process/serialization.js',
       'lib/internal/cluster/child.js',
       'lib/internal/cluster/primary.js',
+      'lib/internal/cluster/reuseport_handle.js',
       'lib/internal/cluster/round_robin_handle.js',
       'lib/internal/cluster/shared_handle.js',
       'lib/internal/cluster/utils.js',
@@ -619,6 +620,7 @@
         'src/node_http_parser.cc',
         'src/node_http2.cc',
         'src/node_i18n.cc',
+        'src/node_io_uring.cc',
         'src/node_main_instance.cc',
         'src/node_messaging.cc',
         'src/node_metadata.cc',
@@ -641,6 +643,7 @@
         'src/node_stat_watcher.cc',
         'src/node_symbols.cc',
         'src/node_task_queue.cc',
+        'src/node_threadpool.cc',
         'src/node_trace_events.cc',
         'src/node_types.cc',
         'src/node_url.cc',
@@ -720,6 +723,7 @@
         'src/node_http2.h',
         'src/node_http2_state.h',
         'src/node_i18n.h',
+        'src/node_io_uring.h',
         'src/node_internals.h',
         'src/node_main_instance.h',
         'src/node_mem.h',
@@ -743,6 +747,7 @@
         'src/node_sockaddr.h',
         'src/node_sockaddr-inl.h',
         'src/node_stat_watcher.h',
+        'src/node_threadpool.h',
         'src/node_union_bytes.h',
         'src/node_url.h',
         'src/node_version.h',